@@ -0,0 +1,240 @@
+#ifndef BLOOM_FILTERED_LIST_H
+#define BLOOM_FILTERED_LIST_H
+
+// Required C++17
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+#include <cmath>        // For std::exp, std::log, std::pow, std::lround
+#include <algorithm>    // For std::max
+#include <vector>       // For std::vector
+#include <functional>   // For std::hash, std::equal_to
+#include <utility>      // For std::move, std::forward
+#include <stdexcept>    // For std::invalid_argument
+
+#include "SinglyLinkedList.h"
+
+/**
+ * @brief A singly linked list with a Bloom filter in front of its membership queries.
+ * * Every insertion sets the element's bits, so `contains()` and `find()`
+ * return at once for values the filter has never seen. Erasing cannot clear
+ * bits; instead, once erasures since the last rebuild pass a fraction of the
+ * size, the filter is marked stale and rebuilt from the live elements on the
+ * next lookup. The filter also doubles, lazily, when the list outgrows it.
+ * Elements are read-only through iterators so the filter cannot go stale.
+ * * @tparam T The type of the elements.
+ * @tparam Hash Hash function on `T`.
+ * @tparam KeyEqual Equality on `T` consistent with `Hash`.
+ */
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class BloomFilteredList
+{
+public:
+    using const_iterator = typename SinglyLinkedList<T>::const_iterator;
+    using iterator = const_iterator;
+
+    /**
+     * @brief Counters describing how well the filter is doing.
+     */
+    struct filter_stats
+    {
+        std::size_t lookups = 0;          // contains() and find() calls
+        std::size_t filtered = 0;         // Definite misses answered without a walk
+        std::size_t false_positives = 0;  // Walks the filter allowed that found nothing
+        std::size_t rebuilds = 0;
+        std::size_t bits = 0;
+        std::size_t hashes = 0;
+        double expected_fpr = 0;          // (1 - e^(-kn/m))^k for the current fill
+
+        /// @brief Observed false-positive rate: false positives over lookups that missed.
+        double false_positive_rate() const {
+            std::size_t misses = filtered + false_positives;
+            return misses ? double(false_positives) / double(misses) : 0.0;
+        }
+    };
+
+private:
+    SinglyLinkedList<T> list_;
+    Hash hash_;
+    KeyEqual eq_;
+    double bits_per_element_;
+    double rebuild_fraction_;
+    std::size_t hashes_;
+    // The filter is refreshed by lookups, which are logically const.
+    mutable std::vector<std::uint64_t> bits_;
+    mutable std::size_t capacity_ = 0;           // Elements the current bit array was sized for
+    mutable std::size_t erased_since_rebuild_ = 0;
+    mutable bool stale_ = true;
+    mutable filter_stats stats_;
+
+    /// @brief Double hashing: probe i sets bit h1 + i * h2. h2 is odd so probes cover the table.
+    template <typename Fn>
+    void for_each_bit(const T &value, Fn fn) const {
+        std::uint64_t h1 = static_cast<std::uint64_t>(hash_(value));
+        std::uint64_t h2 = ((h1 * 0x9E3779B97F4A7C15ull) >> 29) | 1;
+        const std::uint64_t mask = bits_.size() * 64 - 1;
+        for (std::size_t i = 0; i < hashes_; ++i, h1 += h2) fn((h1 & mask) >> 6, std::uint64_t(1) << (h1 & 63));
+    }
+
+    void add_bits(const T &value) const {
+        for_each_bit(value, [this](std::size_t word, std::uint64_t bit) { bits_[word] |= bit; });
+    }
+
+    bool may_contain(const T &value) const {
+        bool maybe = true;
+        for_each_bit(value, [&](std::size_t word, std::uint64_t bit) { maybe = maybe && (bits_[word] & bit); });
+        return maybe;
+    }
+
+    /// @brief Resizes the bit array for the current size and re-adds every live element. O(N).
+    void rebuild() const {
+        capacity_ = std::max<std::size_t>(64, 2 * list_.size());
+        std::size_t words = 1;
+        while (words * 64 < std::size_t(double(capacity_) * bits_per_element_)) words *= 2;
+        bits_.assign(words, 0);
+        for (const T &value : list_) add_bits(value);
+        erased_since_rebuild_ = 0;
+        stale_ = false;
+        ++stats_.rebuilds;
+    }
+
+    void on_insert(const T &value) {
+        if (stale_) return; // The next lookup rebuilds from scratch anyway
+        if (list_.size() > capacity_) stale_ = true;
+        else add_bits(value);
+    }
+
+    void on_erase() {
+        if (++erased_since_rebuild_ > rebuild_fraction_ * double(list_.size() + 1)) stale_ = true;
+    }
+
+    /// @brief Applies the filter. Returns false if `value` is definitely absent.
+    bool admit(const T &value) const {
+        if (stale_) rebuild();
+        ++stats_.lookups;
+        if (!may_contain(value)) {
+            ++stats_.filtered;
+            return false;
+        }
+        return true;
+    }
+
+public:
+    /**
+     * @brief Creates an empty list.
+     * @param bits_per_element Filter bits per element; 10 gives about a 1% false-positive rate.
+     * @param rebuild_fraction Erasures, as a fraction of size(), after which the filter is rebuilt.
+     */
+    explicit BloomFilteredList(double bits_per_element = 10, double rebuild_fraction = 0.25,
+                               Hash hash = Hash(), KeyEqual eq = KeyEqual())
+        : hash_(std::move(hash)), eq_(std::move(eq)), bits_per_element_(bits_per_element),
+          rebuild_fraction_(rebuild_fraction),
+          hashes_(std::max<long>(1, std::lround(bits_per_element * std::log(2.0)))) {
+        if (!(bits_per_element >= 1)) throw std::invalid_argument("BloomFilteredList: bits_per_element must be >= 1");
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return list_.size(); }
+    bool empty() const noexcept { return list_.empty(); }
+
+    // --- MODIFIERS ---
+
+    void push_front(T value) {
+        list_.push_front(std::move(value));
+        on_insert(list_.front());
+    }
+
+    void push_back(T value) {
+        list_.push_back(std::move(value));
+        on_insert(list_.back());
+    }
+
+    template <typename... Args>
+    void emplace_back(Args &&...args) {
+        list_.emplace_back(std::forward<Args>(args)...);
+        on_insert(list_.back());
+    }
+
+    const_iterator insert_after(const_iterator pos, T value) {
+        const_iterator it = list_.insert_after(pos, std::move(value));
+        on_insert(*it);
+        return it;
+    }
+
+    const_iterator erase_after(const_iterator pos) {
+        const_iterator next = list_.erase_after(pos);
+        on_erase();
+        return next;
+    }
+
+    void pop_front() {
+        list_.pop_front();
+        on_erase();
+    }
+
+    void pop_back() {
+        list_.pop_back();
+        on_erase();
+    }
+
+    /// @brief Erases the first element equal to `value`. Misses are answered by the filter. Returns true if erased.
+    bool remove(const T &value) {
+        if (list_.empty() || !admit(value)) return false;
+        const_iterator prev = list_.cend();
+        for (auto it = list_.cbegin(); it != list_.cend(); prev = it, ++it) {
+            if (!eq_(*it, value)) continue;
+            if (prev == list_.cend()) list_.pop_front();
+            else list_.erase_after(prev);
+            on_erase();
+            return true;
+        }
+        ++stats_.false_positives;
+        return false;
+    }
+
+    void clear() noexcept {
+        list_.clear();
+        stale_ = true;
+    }
+
+    // --- LOOKUP ---
+
+    /// @brief Returns the first element equal to `value`, or end(). O(1) for filtered misses, O(N) otherwise.
+    const_iterator find(const T &value) const {
+        if (list_.empty() || !admit(value)) return end();
+        for (auto it = list_.cbegin(); it != list_.cend(); ++it)
+            if (eq_(*it, value)) return it;
+        ++stats_.false_positives;
+        return end();
+    }
+
+    bool contains(const T &value) const { return find(value) != end(); }
+
+    /// @brief Returns the filter counters, with the expected false-positive rate for the current fill.
+    filter_stats stats() const {
+        filter_stats s = stats_;
+        s.bits = bits_.size() * 64;
+        s.hashes = hashes_;
+        if (s.bits) s.expected_fpr = std::pow(1 - std::exp(-double(hashes_) * double(size()) / double(s.bits)), double(hashes_));
+        return s;
+    }
+
+    // --- ELEMENT ACCESS ---
+
+    const T &front() const { return list_.front(); }
+    const T &back() const { return list_.back(); }
+
+    /// @brief Read-only view of the underlying list, e.g. for its algorithms.
+    const SinglyLinkedList<T> &list() const noexcept { return list_; }
+
+    // --- ITERATORS ---
+
+    const_iterator begin() const { return list_.cbegin(); }
+    const_iterator cbegin() const { return list_.cbegin(); }
+    const_iterator end() const { return list_.cend(); }
+    const_iterator cend() const { return list_.cend(); }
+};
+
+#endif // BLOOM_FILTERED_LIST_H
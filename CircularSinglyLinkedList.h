@@ -0,0 +1,301 @@
+#ifndef CIRCULAR_SINGLY_LINKED_LIST_H
+#define CIRCULAR_SINGLY_LINKED_LIST_H
+
+// Required C++17 for std::in_place
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>          // For std::size_t, std::ptrdiff_t
+#include <iterator>         // For std::forward_iterator_tag
+#include <stdexcept>        // For std::out_of_range, std::invalid_argument
+#include <utility>          // For std::move, std::forward, std::swap, std::in_place
+#include <type_traits>      // For std::conditional_t, std::enable_if_t
+#include <initializer_list> // For std::initializer_list constructor
+
+/**
+ * @brief A circular singly linked list: the last node links back to the first.
+ * * Only `tail_` is stored; the head is `tail_->next`. That makes the
+ * round-robin step `rotate()` a single pointer move, with no node freed or
+ * allocated, while `push_front`, `push_back` and `pop_front` stay O(1).
+ * Links are raw pointers because a ring cannot be expressed with
+ * `std::unique_ptr` ownership; the list deletes its nodes itself.
+ * * @tparam T The type of the elements.
+ */
+template <typename T>
+class CircularSinglyLinkedList
+{
+private:
+    struct Node
+    {
+        T data;
+        Node *next;
+
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args &&...args) : data(std::forward<Args>(args)...), next(nullptr) {}
+    };
+
+    Node *tail_;            // Last node; tail_->next is the head. Null when empty.
+    std::size_t list_size;  // Cached size of the list
+
+    Node *head() const noexcept { return tail_ ? tail_->next : nullptr; }
+
+    /// @brief Links a new node as the head. The caller moves tail_ to make it the back.
+    template <typename... Args>
+    Node *link_front(Args &&...args) {
+        Node *node = new Node(std::in_place, std::forward<Args>(args)...);
+        if (!tail_) {
+            node->next = node;
+            tail_ = node;
+        } else {
+            node->next = tail_->next;
+            tail_->next = node;
+        }
+        ++list_size;
+        return node;
+    }
+
+    /// @brief Unlinks and deletes the node after `prev`. Returns the node that followed it, or null if now empty.
+    Node *unlink_after(Node *prev) noexcept {
+        Node *victim = prev->next;
+        Node *next = victim->next;
+        if (victim == prev) {
+            tail_ = nullptr;
+            next = nullptr;
+        } else {
+            prev->next = next;
+            if (victim == tail_) tail_ = prev;
+        }
+        delete victim;
+        --list_size;
+        return next;
+    }
+
+public:
+    /**
+     * @brief A forward iterator that walks to the end of the current lap.
+     * * end() is a null node, not a position in the ring, so it does not move
+     * when the list rotates or grows. Incrementing past the list's current
+     * back reaches end() instead of wrapping to the front. Iterators refer to
+     * their list object, so moving or swapping the list invalidates them.
+     */
+    template <bool Const>
+    class basic_iterator
+    {
+        using NodePtr = std::conditional_t<Const, const Node *, Node *>;
+        NodePtr node_;                         // Null for end()
+        const CircularSinglyLinkedList *list_; // Supplies the back, where a lap stops
+        friend class CircularSinglyLinkedList;
+        friend class basic_iterator<!Const>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        explicit basic_iterator(NodePtr node = nullptr, const CircularSinglyLinkedList *list = nullptr)
+            : node_(node), list_(list) {}
+
+        /// @brief Allows conversion from iterator to const_iterator.
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst> &other) : node_(other.node_), list_(other.list_) {}
+
+        reference operator*() const { return node_->data; }
+        pointer operator->() const { return &node_->data; }
+        basic_iterator &operator++() {
+            node_ = node_ == list_->tail_ ? nullptr : node_->next;
+            return *this;
+        }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const basic_iterator &other) const { return node_ == other.node_; }
+        bool operator!=(const basic_iterator &other) const { return !(*this == other); }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /**
+     * @brief A round-robin position that can walk the ring forever.
+     * * It remembers the node before the current one, so `erase()` is O(1).
+     * Invalidated when the element before it is erased through the list.
+     */
+    class cursor
+    {
+        CircularSinglyLinkedList *list_;
+        Node *prev_;
+        friend class CircularSinglyLinkedList;
+
+        cursor(CircularSinglyLinkedList *list, Node *prev) : list_(list), prev_(prev) {}
+
+    public:
+        /// @brief True while the list has elements to visit.
+        bool valid() const noexcept { return prev_ != nullptr; }
+
+        T &operator*() const { return prev_->next->data; }
+        T *operator->() const { return &prev_->next->data; }
+
+        /// @brief Moves to the next element, wrapping from the back to the front. O(1).
+        cursor &advance() noexcept {
+            prev_ = prev_->next;
+            return *this;
+        }
+
+        /// @brief Erases the current element and moves to the one after it. O(1).
+        void erase() noexcept {
+            if (!list_->unlink_after(prev_)) prev_ = nullptr;
+        }
+    };
+
+    // --- LIFECYCLE ---
+
+    /// @brief Default constructor. Creates an empty list.
+    CircularSinglyLinkedList() noexcept : tail_(nullptr), list_size(0) {}
+
+    /// @brief Destructor. Deletes every node.
+    ~CircularSinglyLinkedList() { clear(); }
+
+    /// @brief Copy constructor. Copies the elements in order from the head.
+    CircularSinglyLinkedList(const CircularSinglyLinkedList &other) : CircularSinglyLinkedList() {
+        for (const auto &value : other) push_back(value);
+    }
+
+    /// @brief Move constructor.
+    CircularSinglyLinkedList(CircularSinglyLinkedList &&other) noexcept
+        : tail_(other.tail_), list_size(other.list_size) {
+        other.tail_ = nullptr;
+        other.list_size = 0;
+    }
+
+    /// @brief Initializer list constructor.
+    CircularSinglyLinkedList(std::initializer_list<T> ilist) : CircularSinglyLinkedList() {
+        for (const auto &value : ilist) push_back(value);
+    }
+
+    /// @brief Copy/move assignment (copy-and-swap idiom).
+    CircularSinglyLinkedList &operator=(CircularSinglyLinkedList other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    friend void swap(CircularSinglyLinkedList &a, CircularSinglyLinkedList &b) noexcept {
+        using std::swap;
+        swap(a.tail_, b.tail_);
+        swap(a.list_size, b.list_size);
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return list_size; }
+    bool empty() const noexcept { return list_size == 0; }
+
+    // --- MODIFIERS ---
+
+    /// @brief Removes all elements. O(N).
+    void clear() noexcept {
+        if (!tail_) return;
+        Node *node = tail_->next;
+        tail_->next = nullptr; // Break the ring
+        while (node) {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+        tail_ = nullptr;
+        list_size = 0;
+    }
+
+    void push_front(const T &value) { link_front(value); }
+    void push_front(T &&value) { link_front(std::move(value)); }
+    void push_back(const T &value) { tail_ = link_front(value); }
+    void push_back(T &&value) { tail_ = link_front(std::move(value)); }
+
+    template <typename... Args>
+    void emplace_back(Args &&...args) { tail_ = link_front(std::forward<Args>(args)...); }
+
+    /// @brief Removes the first element. O(1).
+    void pop_front() {
+        if (!tail_) throw std::out_of_range("pop_front on an empty list");
+        unlink_after(tail_);
+    }
+
+    /**
+     * @brief Inserts after the element at `pos`. Returns an iterator to the new element. O(1).
+     * * Inserting after the back makes the new element the back.
+     * @throws std::invalid_argument if `pos` is end().
+     */
+    iterator insert_after(const_iterator pos, const T &value) { return emplace_after(pos, value); }
+    iterator insert_after(const_iterator pos, T &&value) { return emplace_after(pos, std::move(value)); }
+
+    template <typename... Args>
+    iterator emplace_after(const_iterator pos, Args &&...args) {
+        Node *prev = const_cast<Node *>(pos.node_);
+        if (!prev) throw std::invalid_argument("Cannot insert_after the end iterator");
+        Node *node = new Node(std::in_place, std::forward<Args>(args)...);
+        node->next = prev->next;
+        prev->next = node;
+        if (prev == tail_) tail_ = node;
+        ++list_size;
+        return iterator(node, this);
+    }
+
+    /**
+     * @brief Erases the element after `pos`, wrapping from the back to the front. O(1).
+     * @return An iterator to the element that followed the erased one; end() if the
+     *         erased element was the front or the back.
+     */
+    iterator erase_after(const_iterator pos) {
+        Node *prev = const_cast<Node *>(pos.node_);
+        if (!prev || !tail_) throw std::invalid_argument("Cannot erase_after the end iterator");
+        unlink_after(prev);
+        return tail_ && prev != tail_ ? iterator(prev->next, this) : end();
+    }
+
+    /// @brief Moves the front element to the back: the round-robin step. No allocation. O(1).
+    void rotate() noexcept {
+        if (tail_) tail_ = tail_->next;
+    }
+
+    /// @brief Rotates `k` steps. O(k % size()).
+    void rotate(std::size_t k) noexcept {
+        if (!tail_) return;
+        for (k %= list_size; k > 0; --k) tail_ = tail_->next;
+    }
+
+    /// @brief Returns a cursor on the front element.
+    cursor cursor_begin() noexcept { return cursor(this, tail_); }
+
+    // --- ELEMENT ACCESS ---
+
+    T &front() {
+        if (!tail_) throw std::out_of_range("Accessing front() on an empty list");
+        return tail_->next->data;
+    }
+
+    const T &front() const {
+        if (!tail_) throw std::out_of_range("Accessing front() on an empty list");
+        return tail_->next->data;
+    }
+
+    T &back() {
+        if (!tail_) throw std::out_of_range("Accessing back() on an empty list");
+        return tail_->data;
+    }
+
+    const T &back() const {
+        if (!tail_) throw std::out_of_range("Accessing back() on an empty list");
+        return tail_->data;
+    }
+
+    // --- ITERATORS ---
+
+    /// @brief Iterates one lap, front to back.
+    iterator begin() { return iterator(head(), this); }
+    const_iterator begin() const { return const_iterator(head(), this); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(nullptr, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    const_iterator cend() const { return end(); }
+};
+
+#endif // CIRCULAR_SINGLY_LINKED_LIST_H
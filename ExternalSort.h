@@ -0,0 +1,276 @@
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+// Required C++17 for std::filesystem
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+// POSIX only: run files are created with mkstemp.
+
+#include <cstdio>       // For std::FILE, std::fopen, std::fread, std::fwrite, setvbuf
+#include <cstdint>      // For std::uint64_t
+#include <cstring>      // For std::memcmp, std::memcpy
+#include <cstddef>      // For std::size_t
+#include <string>       // For std::string
+#include <vector>       // For std::vector
+#include <memory>       // For std::unique_ptr
+#include <algorithm>    // For std::push_heap, std::pop_heap
+#include <functional>   // For std::less
+#include <iterator>     // For std::input_iterator_tag, std::iterator_traits
+#include <stdexcept>    // For std::runtime_error, std::logic_error
+#include <type_traits>  // For std::is_trivially_copyable
+#include <filesystem>   // For std::filesystem::temp_directory_path, remove
+#include <stdlib.h>     // For mkstemp
+#include <unistd.h>     // For close
+
+#include "SinglyLinkedList.h"
+
+/**
+ * @brief Sorts more elements than fit in memory by spilling sorted runs to disk.
+ * * Elements are collected into a `SinglyLinkedList` run until the memory
+ * budget is reached; each full run is sorted in place with `sort()` and
+ * written to a temporary file. Reading then merges every run through a small
+ * heap, streaming the elements back in order. If everything fits in one run,
+ * nothing touches the disk. Stable: equal elements come out in input order.
+ *
+ * Run file format (native endianness): a 24-byte header of the magic
+ * "SLLRUN1\0", the element size and the element count, each 8 bytes,
+ * followed by the raw element bytes. All I/O goes through large
+ * sequential stdio buffers.
+ *
+ * @tparam T Element type. Must be trivially copyable.
+ * @tparam Compare Strict weak ordering on `T`.
+ */
+template <typename T, typename Compare = std::less<T>>
+class ExternalSorter
+{
+    static_assert(std::is_trivially_copyable<T>::value, "ExternalSorter writes elements as raw bytes");
+
+    struct RunHeader
+    {
+        char magic[8];
+        std::uint64_t element_size;
+        std::uint64_t count;
+    };
+
+    /// @brief One spilled run being read back during the merge.
+    struct RunReader
+    {
+        std::FILE *file = nullptr;
+        std::vector<char> buffer;
+        std::uint64_t remaining = 0;
+        T current;
+    };
+
+    static constexpr char run_magic[8] = {'S', 'L', 'L', 'R', 'U', 'N', '1', '\0'};
+
+    Compare comp_;
+    std::size_t run_capacity_;  // Elements per in-memory run
+    std::size_t io_buffer_;     // Bytes of stdio buffer per open file
+    std::string tmp_dir_;
+    SinglyLinkedList<T> run_;   // Run being filled, later the in-memory result
+    std::vector<std::string> paths_;
+    std::vector<RunReader> readers_;
+    std::vector<std::size_t> heap_; // Reader indices, smallest current element on top
+    std::size_t total_ = 0;
+    bool merging_ = false;
+
+    /// @brief Spills the current run, sorted, to a new temporary file.
+    void spill() {
+        run_.sort(comp_);
+        std::string path = tmp_dir_ + "/sll-run-XXXXXX";
+        int fd = mkstemp(&path[0]);
+        if (fd < 0) throw std::runtime_error("external_sort: cannot create a run file in " + tmp_dir_);
+        close(fd);
+        paths_.push_back(path);
+
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        if (!file) throw std::runtime_error("external_sort: cannot open " + path);
+        std::vector<char> buffer(io_buffer_);
+        setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+        RunHeader header{};
+        std::memcpy(header.magic, run_magic, sizeof run_magic);
+        header.element_size = sizeof(T);
+        header.count = run_.size();
+        bool ok = std::fwrite(&header, sizeof header, 1, file) == 1;
+        for (const T &value : run_) ok = ok && std::fwrite(&value, sizeof(T), 1, file) == 1;
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok) throw std::runtime_error("external_sort: write failed on " + path);
+        run_.clear();
+    }
+
+    /// @brief Reads the next element of a run into `current`. Returns false when the run is exhausted.
+    static bool advance(RunReader &reader) {
+        if (reader.remaining == 0) return false;
+        if (std::fread(&reader.current, sizeof(T), 1, reader.file) != 1)
+            throw std::runtime_error("external_sort: truncated run file");
+        --reader.remaining;
+        return true;
+    }
+
+    /// @brief Heap order: `a` sinks below `b` if b's element comes first. Ties go to the earlier run.
+    bool heap_after(std::size_t a, std::size_t b) const {
+        const T &x = readers_[a].current, &y = readers_[b].current;
+        if (comp_(y, x)) return true;
+        return !comp_(x, y) && b < a;
+    }
+
+    void open_runs() {
+        // Share the memory budget between the read buffers, within [4 KiB, io_buffer].
+        std::size_t per_run = std::max<std::size_t>(4096, std::min(io_buffer_, run_capacity_ * sizeof(T) / paths_.size()));
+        readers_.resize(paths_.size());
+        for (std::size_t i = 0; i < paths_.size(); ++i) {
+            RunReader &reader = readers_[i];
+            reader.file = std::fopen(paths_[i].c_str(), "rb");
+            if (!reader.file) throw std::runtime_error("external_sort: cannot reopen " + paths_[i]);
+            reader.buffer.resize(per_run);
+            setvbuf(reader.file, reader.buffer.data(), _IOFBF, reader.buffer.size());
+            RunHeader header;
+            if (std::fread(&header, sizeof header, 1, reader.file) != 1 ||
+                std::memcmp(header.magic, run_magic, sizeof run_magic) != 0 || header.element_size != sizeof(T))
+                throw std::runtime_error("external_sort: bad run file " + paths_[i]);
+            reader.remaining = header.count;
+            if (advance(reader)) heap_.push_back(i);
+        }
+        auto after = [this](std::size_t a, std::size_t b) { return heap_after(a, b); };
+        std::make_heap(heap_.begin(), heap_.end(), after);
+    }
+
+public:
+    /**
+     * @brief Creates a sorter.
+     * @param comp Ordering of the output.
+     * @param memory_budget Approximate bytes of list nodes to hold in memory per run.
+     * @param tmp_dir Directory for run files; empty selects the system temporary directory.
+     * @param io_buffer Bytes of stdio buffer for each run file.
+     */
+    explicit ExternalSorter(Compare comp = Compare(), std::size_t memory_budget = std::size_t(64) << 20,
+                            std::string tmp_dir = std::string(), std::size_t io_buffer = std::size_t(1) << 20)
+        : comp_(std::move(comp)),
+          // A list node holds the element and a pointer, plus about two words of allocator overhead.
+          run_capacity_(std::max<std::size_t>(1, memory_budget / (sizeof(T) + 3 * sizeof(void *)))),
+          io_buffer_(std::max<std::size_t>(4096, io_buffer)),
+          tmp_dir_(tmp_dir.empty() ? std::filesystem::temp_directory_path().string() : std::move(tmp_dir)) {}
+
+    ExternalSorter(const ExternalSorter &) = delete;
+    ExternalSorter &operator=(const ExternalSorter &) = delete;
+
+    /// @brief Closes and deletes every run file.
+    ~ExternalSorter() {
+        for (auto &reader : readers_) if (reader.file) std::fclose(reader.file);
+        std::error_code ignored;
+        for (const auto &path : paths_) std::filesystem::remove(path, ignored);
+    }
+
+    /// @brief Adds an element. Spills a sorted run when the budget is full. Must precede reading.
+    void push(const T &value) {
+        if (merging_) throw std::logic_error("ExternalSorter: push after reading started");
+        run_.push_back(value);
+        ++total_;
+        if (run_.size() == run_capacity_) spill();
+    }
+
+    /// @brief Adds every element of [first, last).
+    template <typename InputIt>
+    void push(InputIt first, InputIt last) {
+        for (; first != last; ++first) push(*first);
+    }
+
+    /// @brief Returns the number of elements pushed.
+    std::size_t size() const noexcept { return total_; }
+
+    /// @brief Returns the number of runs spilled to disk so far.
+    std::size_t spilled_runs() const noexcept { return paths_.size(); }
+
+    /**
+     * @brief Streams the next element in sorted order into `out`.
+     * * The first call sorts the last run and starts the merge; no more
+     * elements may be pushed afterwards. O(log runs) per element.
+     * @return False once every element has been read.
+     */
+    bool next(T &out) {
+        if (!merging_) {
+            merging_ = true;
+            if (paths_.empty()) run_.sort(comp_);
+            else {
+                if (!run_.empty()) spill();
+                open_runs();
+            }
+        }
+        if (paths_.empty()) {
+            if (run_.empty()) return false;
+            out = run_.front();
+            run_.pop_front();
+            return true;
+        }
+        if (heap_.empty()) return false;
+        auto after = [this](std::size_t a, std::size_t b) { return heap_after(a, b); };
+        std::pop_heap(heap_.begin(), heap_.end(), after);
+        std::size_t top = heap_.back();
+        out = readers_[top].current;
+        if (advance(readers_[top])) std::push_heap(heap_.begin(), heap_.end(), after);
+        else heap_.pop_back();
+        return true;
+    }
+
+    /// @brief Drains the sorter into a rebuilt list. Reuses the in-memory run when nothing was spilled.
+    SinglyLinkedList<T> to_list() {
+        if (!merging_ && paths_.empty()) {
+            merging_ = true;
+            run_.sort(comp_);
+            return std::move(run_);
+        }
+        SinglyLinkedList<T> result;
+        T value;
+        while (next(value)) result.push_back(value);
+        return result;
+    }
+
+    /**
+     * @brief A single-pass input iterator over the sorted output.
+     */
+    class iterator
+    {
+        ExternalSorter *sorter_;
+        T value_;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        explicit iterator(ExternalSorter *sorter = nullptr) : sorter_(sorter), value_() {
+            if (sorter_ && !sorter_->next(value_)) sorter_ = nullptr;
+        }
+
+        reference operator*() const { return value_; }
+        pointer operator->() const { return &value_; }
+        iterator &operator++() {
+            if (!sorter_->next(value_)) sorter_ = nullptr;
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const { return sorter_ == other.sorter_; }
+        bool operator!=(const iterator &other) const { return sorter_ != other.sorter_; }
+    };
+
+    /// @brief Starts streaming the sorted output. Call once.
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+};
+
+/**
+ * @brief Sorts [first, last) using at most about `memory_budget` bytes of nodes and returns the result as a list.
+ * * See ExternalSorter for the run format and for streaming the output instead.
+ * O(N log N) comparisons; each element is written and read once when it spills.
+ */
+template <typename InputIt, typename Compare = std::less<typename std::iterator_traits<InputIt>::value_type>>
+SinglyLinkedList<typename std::iterator_traits<InputIt>::value_type>
+external_sort(InputIt first, InputIt last, Compare comp = Compare(), std::size_t memory_budget = std::size_t(64) << 20,
+              const std::string &tmp_dir = std::string()) {
+    ExternalSorter<typename std::iterator_traits<InputIt>::value_type, Compare> sorter(std::move(comp), memory_budget, tmp_dir);
+    sorter.push(first, last);
+    return sorter.to_list();
+}
+
+#endif // EXTERNAL_SORT_H
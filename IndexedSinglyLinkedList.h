@@ -0,0 +1,226 @@
+#ifndef INDEXED_SINGLY_LINKED_LIST_H
+#define INDEXED_SINGLY_LINKED_LIST_H
+
+// Required C++17 for std::invoke_result_t
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>        // For std::size_t
+#include <functional>     // For std::invoke, std::hash, std::equal_to
+#include <stdexcept>      // For std::invalid_argument, std::out_of_range
+#include <type_traits>    // For std::invoke_result_t, std::decay_t
+#include <unordered_map>  // For std::unordered_map
+#include <utility>        // For std::move
+#include <iterator>       // For std::next
+
+#include "SinglyLinkedList.h"
+
+/**
+ * @brief A singly linked list with a hash index from each element's key to its predecessor.
+ * * Knowing the predecessor turns erase-by-key into an O(1) `erase_after`,
+ * so `find(key)`, `contains(key)` and `erase(key)` never walk the list. The
+ * index is kept exact by every modifier; keys must be unique. Elements are
+ * read-only through iterators so a key cannot change behind the index.
+ * * @tparam T The type of the elements.
+ * @tparam KeyFn Callable mapping `const T&` to the key, e.g. a lambda returning `s.id`.
+ * @tparam Hash Hash function on the key.
+ * @tparam KeyEqual Equality on the key.
+ */
+template <typename T, typename KeyFn,
+          typename Hash = std::hash<std::decay_t<std::invoke_result_t<KeyFn &, const T &>>>,
+          typename KeyEqual = std::equal_to<std::decay_t<std::invoke_result_t<KeyFn &, const T &>>>>
+class IndexedSinglyLinkedList
+{
+public:
+    using key_type = std::decay_t<std::invoke_result_t<KeyFn &, const T &>>;
+    using const_iterator = typename SinglyLinkedList<T>::const_iterator;
+    using iterator = const_iterator;
+
+private:
+    SinglyLinkedList<T> list_;
+    KeyFn key_;
+    // Maps each key to the iterator before its element; cend() marks the head.
+    std::unordered_map<key_type, const_iterator, Hash, KeyEqual> index_;
+    const_iterator last_; // The tail, kept so push_back knows the new element's predecessor
+
+    key_type key_of(const T &value) { return std::invoke(key_, value); }
+
+    /// @brief Reserves the index entry for a new element, rejecting duplicate keys.
+    typename std::unordered_map<key_type, const_iterator, Hash, KeyEqual>::iterator
+    claim(const T &value, const_iterator predecessor) {
+        auto [slot, fresh] = index_.emplace(key_of(value), predecessor);
+        if (!fresh) throw std::invalid_argument("IndexedSinglyLinkedList: duplicate key");
+        return slot;
+    }
+
+    /// @brief Points the element after `pos` (if any) at its new predecessor `pos`.
+    void repoint_next(const_iterator pos) {
+        const_iterator next = pos == list_.cend() ? list_.cbegin() : std::next(pos);
+        if (next != list_.cend()) index_.find(key_of(*next))->second = pos;
+    }
+
+    void rebuild_index() {
+        index_.clear();
+        const_iterator prev = list_.cend();
+        for (auto it = list_.cbegin(); it != list_.cend(); prev = it, ++it) index_.emplace(key_of(*it), prev);
+        last_ = prev;
+    }
+
+public:
+    /// @brief Creates an empty list indexed by `key`.
+    explicit IndexedSinglyLinkedList(KeyFn key = KeyFn())
+        : key_(std::move(key)), last_(list_.cend()) {}
+
+    IndexedSinglyLinkedList(const IndexedSinglyLinkedList &other)
+        : list_(other.list_), key_(other.key_) {
+        rebuild_index();
+    }
+
+    // The index holds iterators into the nodes, which a move keeps valid.
+    IndexedSinglyLinkedList(IndexedSinglyLinkedList &&other) noexcept
+        : list_(std::move(other.list_)), key_(std::move(other.key_)), index_(std::move(other.index_)),
+          last_(other.last_) {
+        other.index_.clear();
+        other.last_ = other.list_.cend();
+    }
+
+    /// @brief Copy/move assignment (copy-and-swap idiom).
+    IndexedSinglyLinkedList &operator=(IndexedSinglyLinkedList other) noexcept {
+        using std::swap;
+        swap(list_, other.list_);
+        swap(key_, other.key_);
+        swap(index_, other.index_);
+        swap(last_, other.last_);
+        return *this;
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return list_.size(); }
+    bool empty() const noexcept { return list_.empty(); }
+
+    // --- MODIFIERS ---
+
+    /// @brief Inserts at the front. Throws std::invalid_argument on a duplicate key. O(1).
+    void push_front(T value) {
+        auto slot = claim(value, list_.cend());
+        try {
+            list_.push_front(std::move(value));
+        } catch (...) {
+            index_.erase(slot);
+            throw;
+        }
+        if (list_.size() == 1) last_ = list_.cbegin();
+        else index_.find(key_of(*std::next(list_.cbegin())))->second = list_.cbegin();
+    }
+
+    /// @brief Appends at the back. Throws std::invalid_argument on a duplicate key. O(1).
+    void push_back(T value) {
+        auto slot = claim(value, last_);
+        try {
+            list_.push_back(std::move(value));
+        } catch (...) {
+            index_.erase(slot);
+            throw;
+        }
+        last_ = last_ == list_.cend() ? list_.cbegin() : std::next(last_);
+    }
+
+    /// @brief Inserts after `pos`. Throws std::invalid_argument on a duplicate key. O(1).
+    const_iterator insert_after(const_iterator pos, T value) {
+        auto slot = claim(value, pos);
+        const_iterator it;
+        try {
+            it = list_.insert_after(pos, std::move(value));
+        } catch (...) {
+            index_.erase(slot);
+            throw;
+        }
+        if (last_ == pos) last_ = it;
+        else repoint_next(it);
+        return it;
+    }
+
+    /// @brief Erases the element after `pos`. Returns an iterator to the element that followed it. O(1).
+    const_iterator erase_after(const_iterator pos) {
+        if (pos == list_.cend() || std::next(pos) == list_.cend())
+            throw std::out_of_range("erase_after: no element after the given position");
+        index_.erase(key_of(*std::next(pos)));
+        if (last_ == std::next(pos)) last_ = pos;
+        const_iterator next = list_.erase_after(pos);
+        repoint_next(pos);
+        return next;
+    }
+
+    /// @brief Removes the first element. O(1).
+    void pop_front() {
+        if (list_.empty()) throw std::out_of_range("pop_front on an empty list");
+        index_.erase(key_of(list_.front()));
+        list_.pop_front();
+        if (list_.empty()) last_ = list_.cend();
+        else index_.find(key_of(list_.front()))->second = list_.cend();
+    }
+
+    /// @brief Removes the last element. O(1): the index knows the tail's predecessor.
+    void pop_back() {
+        if (list_.empty()) throw std::out_of_range("pop_back on an empty list");
+        const_iterator before = index_.find(key_of(*last_))->second;
+        if (before == list_.cend()) pop_front();
+        else erase_after(before);
+    }
+
+    /// @brief Erases the element with the given key. Returns false if there is none. O(1) expected.
+    bool erase(const key_type &key) {
+        auto slot = index_.find(key);
+        if (slot == index_.end()) return false;
+        if (slot->second == list_.cend()) pop_front();
+        else erase_after(slot->second);
+        return true;
+    }
+
+    /// @brief Reverses the list and rebuilds the index. O(N).
+    void reverse() {
+        list_.reverse();
+        rebuild_index();
+    }
+
+    void clear() noexcept {
+        list_.clear();
+        index_.clear();
+        last_ = list_.cend();
+    }
+
+    // --- LOOKUP ---
+
+    /// @brief Returns an iterator to the element with the given key, or end(). O(1) expected.
+    const_iterator find(const key_type &key) const {
+        auto slot = index_.find(key);
+        if (slot == index_.end()) return end();
+        return slot->second == list_.cend() ? list_.cbegin() : std::next(slot->second);
+    }
+
+    bool contains(const key_type &key) const { return index_.count(key) != 0; }
+
+    /// @brief Returns the iterator before the element with the given key (cend() for the head). Throws if absent.
+    const_iterator predecessor(const key_type &key) const {
+        auto slot = index_.find(key);
+        if (slot == index_.end()) throw std::out_of_range("predecessor: no element with this key");
+        return slot->second;
+    }
+
+    // --- ELEMENT ACCESS ---
+
+    const T &front() const { return list_.front(); }
+    const T &back() const { return list_.back(); }
+
+    /// @brief Read-only view of the underlying list.
+    const SinglyLinkedList<T> &list() const noexcept { return list_; }
+
+    // --- ITERATORS ---
+
+    const_iterator begin() const { return list_.cbegin(); }
+    const_iterator cbegin() const { return list_.cbegin(); }
+    const_iterator end() const { return list_.cend(); }
+    const_iterator cend() const { return list_.cend(); }
+};
+
+#endif // INDEXED_SINGLY_LINKED_LIST_H
@@ -0,0 +1,188 @@
+#ifndef LAZY_DELETION_LIST_H
+#define LAZY_DELETION_LIST_H
+
+// Required C++17
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>      // For std::size_t, std::ptrdiff_t
+#include <iterator>     // For std::forward_iterator_tag
+#include <stdexcept>    // For std::out_of_range, std::invalid_argument
+#include <type_traits>  // For std::conditional_t
+#include <utility>      // For std::move, std::forward, std::in_place
+#include <initializer_list> // For std::initializer_list constructor
+
+#include "SinglyLinkedList.h"
+
+/**
+ * @brief A singly linked list whose erasures are O(1) tombstones, swept in batches.
+ * * `mark_erased(it)` only flags the element, so erasing from the middle needs
+ * no predecessor. Iterators skip tombstones and `size()` counts live elements
+ * in O(1). `purge()` unlinks every tombstone in one pass and frees the nodes
+ * together; with `set_auto_purge(f)` the sweep also runs on insertion once
+ * tombstones exceed the fraction `f` of all nodes. A purge invalidates
+ * iterators to erased elements only.
+ * * @tparam T The type of the elements.
+ */
+template <typename T>
+class LazyDeletionList
+{
+    struct Entry
+    {
+        T value;
+        bool erased;
+
+        template <typename... Args>
+        explicit Entry(std::in_place_t, Args &&...args) : value(std::forward<Args>(args)...), erased(false) {}
+    };
+
+    using Storage = SinglyLinkedList<Entry>;
+
+    Storage entries_;
+    std::size_t tombstones_ = 0;
+    double auto_purge_fraction_ = 0; // 0 disables the automatic sweep
+
+    void maybe_purge() {
+        if (auto_purge_fraction_ > 0 && double(tombstones_) > auto_purge_fraction_ * double(entries_.size())) purge();
+    }
+
+    /**
+     * @brief A forward iterator over live elements.
+     */
+    template <bool Const>
+    class basic_iterator
+    {
+        using Inner = std::conditional_t<Const, typename Storage::const_iterator, typename Storage::iterator>;
+        Inner it_;
+        friend class LazyDeletionList;
+
+        void skip() {
+            while (it_ != Inner() && it_->erased) ++it_;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        explicit basic_iterator(Inner it = Inner()) : it_(it) { skip(); }
+
+        /// @brief Allows conversion from iterator to const_iterator.
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst> &other) : it_(other.it_) {}
+
+        reference operator*() const { return it_->value; }
+        pointer operator->() const { return &it_->value; }
+        basic_iterator &operator++() { ++it_; skip(); return *this; }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const basic_iterator &other) const { return it_ == other.it_; }
+        bool operator!=(const basic_iterator &other) const { return it_ != other.it_; }
+    };
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    LazyDeletionList() = default;
+
+    /// @brief Initializer list constructor.
+    LazyDeletionList(std::initializer_list<T> ilist) {
+        for (const auto &value : ilist) push_back(value);
+    }
+
+    // --- CAPACITY ---
+
+    /// @brief Returns the number of live elements. O(1).
+    std::size_t size() const noexcept { return entries_.size() - tombstones_; }
+    bool empty() const noexcept { return size() == 0; }
+    /// @brief Returns the number of erased elements still linked. O(1).
+    std::size_t tombstones() const noexcept { return tombstones_; }
+
+    // --- MODIFIERS ---
+
+    void push_front(T value) {
+        maybe_purge();
+        entries_.emplace_front(std::in_place, std::move(value));
+    }
+
+    void push_back(T value) {
+        maybe_purge();
+        entries_.emplace_back(std::in_place, std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args &&...args) {
+        maybe_purge();
+        entries_.emplace_back(std::in_place, std::forward<Args>(args)...);
+    }
+
+    /// @brief Inserts after the live element at `pos`. Does not trigger the automatic sweep. O(1).
+    iterator insert_after(const_iterator pos, T value) {
+        if (pos == cend()) throw std::invalid_argument("Cannot insert_after the end iterator");
+        return iterator(entries_.emplace_after(pos.it_, std::in_place, std::move(value)));
+    }
+
+    /**
+     * @brief Erases the element at `pos` by flagging it. O(1).
+     * * The node stays linked until the next purge, so `pos` may still be
+     * incremented afterwards. Marking an element that is already erased
+     * changes nothing, so the tombstone count stays exact.
+     * @return An iterator to the next live element.
+     */
+    iterator mark_erased(iterator pos) {
+        if (pos == end()) throw std::out_of_range("Cannot erase the end iterator");
+        if (!pos.it_->erased) {
+            pos.it_->erased = true;
+            ++tombstones_;
+        }
+        return ++pos;
+    }
+
+    /**
+     * @brief Unlinks and frees every tombstone in one pass. O(N).
+     * @return The number of nodes freed.
+     */
+    std::size_t purge() {
+        if (tombstones_ == 0) return 0;
+        std::size_t freed = entries_.remove_if([](const Entry &e) { return e.erased; });
+        tombstones_ = 0;
+        return freed;
+    }
+
+    /// @brief Enables the sweep on insertion once tombstones exceed `fraction` of all nodes; 0 disables it.
+    void set_auto_purge(double fraction) {
+        if (fraction < 0 || fraction >= 1) throw std::invalid_argument("set_auto_purge: fraction must be in [0, 1)");
+        auto_purge_fraction_ = fraction;
+    }
+
+    void clear() noexcept {
+        entries_.clear();
+        tombstones_ = 0;
+    }
+
+    // --- ELEMENT ACCESS ---
+
+    /// @brief Accesses the first live element. Throws if there is none. O(leading tombstones).
+    T &front() {
+        if (empty()) throw std::out_of_range("Accessing front() on an empty list");
+        return *begin();
+    }
+
+    const T &front() const {
+        if (empty()) throw std::out_of_range("Accessing front() on an empty list");
+        return *begin();
+    }
+
+    // --- ITERATORS ---
+
+    iterator begin() { return iterator(entries_.begin()); }
+    const_iterator begin() const { return const_iterator(entries_.cbegin()); }
+    const_iterator cbegin() const { return const_iterator(entries_.cbegin()); }
+    iterator end() { return iterator(); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cend() const { return const_iterator(); }
+};
+
+#endif // LAZY_DELETION_LIST_H
@@ -0,0 +1,463 @@
+#ifndef LIST_POOL_H
+#define LIST_POOL_H
+
+// Required C++17 for std::launder
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>      // For std::size_t, std::ptrdiff_t
+#include <cstdint>      // For std::uint32_t
+#include <memory>       // For std::unique_ptr
+#include <new>          // For placement new, std::launder
+#include <vector>       // For std::vector
+#include <iterator>     // For std::forward_iterator_tag
+#include <stdexcept>    // For std::out_of_range, std::invalid_argument, std::length_error
+#include <type_traits>  // For std::conditional_t, std::enable_if_t
+#include <utility>      // For std::move, std::forward, std::swap
+
+/**
+ * @brief Node storage shared by many lightweight singly linked lists.
+ * * Nodes live in fixed-size blocks owned by the pool and are linked by
+ * 32-bit indices, so thousands of small lists draw from a few large
+ * allocations instead of one heap block per node. Moving a node or splicing
+ * a whole list between lists of the same pool only rewrites indices: O(1),
+ * no allocation, and element addresses never change. `reset()` frees every
+ * list at once. The pool must outlive its lists and cannot be copied or moved.
+ * * @tparam T The type of the elements.
+ */
+template <typename T>
+class ListPool
+{
+    static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+    static constexpr std::size_t block_slots = 1024;
+
+    struct Slot
+    {
+        alignas(T) unsigned char bytes[sizeof(T)];
+        std::uint32_t next;
+        std::uint32_t generation; // Bumped each time the element is destroyed
+        bool live;
+
+        T &value() noexcept { return *std::launder(reinterpret_cast<T *>(bytes)); }
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> blocks_;
+    std::uint32_t free_head_ = npos;
+    std::size_t live_ = 0;
+    std::size_t epoch_ = 0; // Bumped by reset() so lists can tell their nodes are gone
+
+    Slot &slot(std::uint32_t index) noexcept { return blocks_[index / block_slots][index % block_slots]; }
+    const Slot &slot(std::uint32_t index) const noexcept { return blocks_[index / block_slots][index % block_slots]; }
+
+    std::size_t capacity() const noexcept { return blocks_.size() * block_slots; }
+
+    void add_block() {
+        if (capacity() + block_slots > npos) throw std::length_error("ListPool: too many nodes for 32-bit indices");
+        blocks_.push_back(std::unique_ptr<Slot[]>(new Slot[block_slots]));
+        const std::uint32_t base = static_cast<std::uint32_t>(capacity() - block_slots);
+        Slot *block = blocks_.back().get();
+        // Thread the new slots onto the free list in address order.
+        for (std::size_t i = 0; i < block_slots; ++i) {
+            block[i].live = false;
+            block[i].generation = 0;
+            block[i].next = i + 1 < block_slots ? base + static_cast<std::uint32_t>(i + 1) : free_head_;
+        }
+        free_head_ = base;
+    }
+
+    /// @brief Takes a free slot and constructs an element in it.
+    template <typename... Args>
+    std::uint32_t acquire(Args &&...args) {
+        if (free_head_ == npos) add_block();
+        std::uint32_t index = free_head_;
+        Slot &s = slot(index);
+        ::new (static_cast<void *>(s.bytes)) T(std::forward<Args>(args)...); // The slot stays free if this throws
+        free_head_ = s.next;
+        s.next = npos;
+        s.live = true;
+        ++live_;
+        return index;
+    }
+
+    /// @brief Destroys the element in a slot and returns the slot to the free list.
+    void release(std::uint32_t index) noexcept {
+        Slot &s = slot(index);
+        s.value().~T();
+        s.live = false;
+        ++s.generation;
+        s.next = free_head_;
+        free_head_ = index;
+        --live_;
+    }
+
+public:
+    /**
+     * @brief Occupancy figures for the pool.
+     */
+    struct pool_stats
+    {
+        std::size_t capacity = 0;  // Slots allocated
+        std::size_t live = 0;      // Slots holding an element
+        std::size_t free = 0;      // Slots ready for reuse
+        std::size_t blocks = 0;    // Block allocations made
+        std::size_t bytes = 0;     // Memory held by the blocks
+
+        /// @brief Fraction of slots in use.
+        double occupancy() const noexcept { return capacity ? double(live) / double(capacity) : 0.0; }
+    };
+
+    class list;
+
+    /**
+     * @brief A stable, copyable reference to one pooled element: slot index plus generation.
+     * * Unlike an iterator it never dangles: once the element is erased, or
+     * its slot recycled for another element, `resolve()` returns null.
+     * Generations are 32-bit, so a handle could only be fooled after its
+     * slot has been reused about four billion times.
+     */
+    struct handle
+    {
+        std::uint32_t index = npos;
+        std::uint32_t generation = 0;
+
+        bool operator==(const handle &other) const noexcept { return index == other.index && generation == other.generation; }
+        bool operator!=(const handle &other) const noexcept { return !(*this == other); }
+    };
+
+    /// @brief Creates a pool, optionally with room for `reserve_nodes` nodes.
+    explicit ListPool(std::size_t reserve_nodes = 0) { reserve(reserve_nodes); }
+
+    ListPool(const ListPool &) = delete;
+    ListPool &operator=(const ListPool &) = delete;
+
+    /// @brief Destroys every element still held by any list.
+    ~ListPool() { destroy_live(); }
+
+    /// @brief Makes room for at least `nodes` nodes in total.
+    void reserve(std::size_t nodes) {
+        while (capacity() < nodes) add_block();
+    }
+
+    /**
+     * @brief Frees every list at once. O(capacity).
+     * * All lists of this pool become empty; their iterators are invalidated.
+     * The blocks are kept for reuse.
+     */
+    void reset() noexcept {
+        destroy_live();
+        free_head_ = npos;
+        for (std::size_t b = blocks_.size(); b-- > 0;) {
+            Slot *block = blocks_[b].get();
+            const std::uint32_t base = static_cast<std::uint32_t>(b * block_slots);
+            for (std::size_t i = 0; i < block_slots; ++i)
+                block[i].next = i + 1 < block_slots ? base + static_cast<std::uint32_t>(i + 1) : free_head_;
+            free_head_ = base;
+        }
+        ++epoch_;
+    }
+
+    /**
+     * @brief Returns the element a handle refers to, or null if it was erased or its slot reused. O(1).
+     */
+    T *resolve(handle h) noexcept {
+        if (h.index >= capacity()) return nullptr;
+        Slot &s = slot(h.index);
+        return s.live && s.generation == h.generation ? &s.value() : nullptr;
+    }
+
+    const T *resolve(handle h) const noexcept { return const_cast<ListPool *>(this)->resolve(h); }
+
+    /// @brief Returns how full the pool is.
+    pool_stats stats() const noexcept {
+        pool_stats s;
+        s.capacity = capacity();
+        s.live = live_;
+        s.free = s.capacity - live_;
+        s.blocks = blocks_.size();
+        s.bytes = s.blocks * block_slots * sizeof(Slot);
+        return s;
+    }
+
+private:
+    void destroy_live() noexcept {
+        if (live_ == 0) return;
+        for (auto &block : blocks_)
+            for (std::size_t i = 0; i < block_slots; ++i)
+                if (block[i].live) {
+                    block[i].value().~T();
+                    block[i].live = false;
+                    ++block[i].generation;
+                }
+        live_ = 0;
+    }
+};
+
+/**
+ * @brief A singly linked list whose nodes come from a ListPool.
+ * * A handle of three indices and a size. Destroying or clearing it returns
+ * its nodes to the pool. After `ListPool::reset()` the handle is empty.
+ */
+template <typename T>
+class ListPool<T>::list
+{
+    ListPool *pool_;
+    std::uint32_t head_ = npos;
+    std::uint32_t tail_ = npos;
+    std::size_t size_ = 0;
+    std::size_t epoch_;
+
+    /// @brief Forgets nodes that a pool reset already freed.
+    void sync() noexcept {
+        if (epoch_ != pool_->epoch_) {
+            head_ = tail_ = npos;
+            size_ = 0;
+            epoch_ = pool_->epoch_;
+        }
+    }
+
+    void link_back(std::uint32_t index) noexcept {
+        if (tail_ == npos) head_ = index;
+        else pool_->slot(tail_).next = index;
+        tail_ = index;
+        ++size_;
+    }
+
+    void link_front(std::uint32_t index) noexcept {
+        pool_->slot(index).next = head_;
+        head_ = index;
+        if (tail_ == npos) tail_ = index;
+        ++size_;
+    }
+
+    std::uint32_t unlink_front() noexcept {
+        std::uint32_t index = head_;
+        head_ = pool_->slot(index).next;
+        if (head_ == npos) tail_ = npos;
+        pool_->slot(index).next = npos;
+        --size_;
+        return index;
+    }
+
+    void check_same_pool(const list &other) const {
+        if (other.pool_ != pool_) throw std::invalid_argument("ListPool: lists belong to different pools");
+    }
+
+public:
+    /**
+     * @brief A forward iterator over a pooled list.
+     */
+    template <bool Const>
+    class basic_iterator
+    {
+        using Pool = std::conditional_t<Const, const ListPool, ListPool>;
+        Pool *pool_;
+        std::uint32_t index_;
+        friend class list;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        explicit basic_iterator(Pool *pool = nullptr, std::uint32_t index = npos) : pool_(pool), index_(index) {}
+
+        /// @brief Allows conversion from iterator to const_iterator.
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst> &other) : pool_(other.pool_), index_(other.index_) {}
+
+        reference operator*() const { return const_cast<ListPool *>(pool_)->slot(index_).value(); }
+        pointer operator->() const { return &**this; }
+        basic_iterator &operator++() { index_ = pool_->slot(index_).next; return *this; }
+        basic_iterator operator++(int) { basic_iterator tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const basic_iterator &other) const { return index_ == other.index_; }
+        bool operator!=(const basic_iterator &other) const { return index_ != other.index_; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // --- LIFECYCLE ---
+
+    /// @brief Creates an empty list drawing nodes from `pool`.
+    explicit list(ListPool &pool) noexcept : pool_(&pool), epoch_(pool.epoch_) {}
+
+    /// @brief Returns the nodes to the pool.
+    ~list() { clear(); }
+
+    list(const list &) = delete;
+    list &operator=(const list &) = delete;
+
+    /// @brief Move constructor. The source is left empty in the same pool.
+    list(list &&other) noexcept
+        : pool_(other.pool_), head_(other.head_), tail_(other.tail_), size_(other.size_), epoch_(other.epoch_) {
+        other.head_ = other.tail_ = npos;
+        other.size_ = 0;
+    }
+
+    /// @brief Move assignment. Frees this list's nodes first.
+    list &operator=(list &&other) noexcept {
+        if (this != &other) {
+            clear();
+            pool_ = other.pool_;
+            head_ = other.head_;
+            tail_ = other.tail_;
+            size_ = other.size_;
+            epoch_ = other.epoch_;
+            other.head_ = other.tail_ = npos;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return epoch_ == pool_->epoch_ ? size_ : 0; }
+    bool empty() const noexcept { return size() == 0; }
+
+    // --- MODIFIERS ---
+
+    /// @brief Returns every node to the pool. O(N).
+    void clear() noexcept {
+        sync();
+        while (head_ != npos) pool_->release(unlink_front());
+    }
+
+    void push_front(const T &value) { sync(); link_front(pool_->acquire(value)); }
+    void push_front(T &&value) { sync(); link_front(pool_->acquire(std::move(value))); }
+    void push_back(const T &value) { sync(); link_back(pool_->acquire(value)); }
+    void push_back(T &&value) { sync(); link_back(pool_->acquire(std::move(value))); }
+
+    template <typename... Args>
+    void emplace_back(Args &&...args) { sync(); link_back(pool_->acquire(std::forward<Args>(args)...)); }
+
+    template <typename... Args>
+    void emplace_front(Args &&...args) { sync(); link_front(pool_->acquire(std::forward<Args>(args)...)); }
+
+    /// @brief Removes the first element. O(1).
+    void pop_front() {
+        sync();
+        if (head_ == npos) throw std::out_of_range("pop_front on an empty list");
+        pool_->release(unlink_front());
+    }
+
+    /// @brief Inserts after `pos`. Returns an iterator to the new element. O(1).
+    iterator insert_after(const_iterator pos, T value) {
+        sync();
+        if (pos.index_ == npos) throw std::invalid_argument("Cannot insert_after the end iterator");
+        std::uint32_t index = pool_->acquire(std::move(value));
+        Slot &prev = pool_->slot(pos.index_);
+        pool_->slot(index).next = prev.next;
+        prev.next = index;
+        if (tail_ == pos.index_) tail_ = index;
+        ++size_;
+        return iterator(pool_, index);
+    }
+
+    /// @brief Erases the element after `pos`. Returns an iterator to the element that followed it. O(1).
+    iterator erase_after(const_iterator pos) {
+        sync();
+        if (pos.index_ == npos || pool_->slot(pos.index_).next == npos)
+            throw std::out_of_range("erase_after: no element after the given position");
+        Slot &prev = pool_->slot(pos.index_);
+        std::uint32_t victim = prev.next;
+        prev.next = pool_->slot(victim).next;
+        if (tail_ == victim) tail_ = pos.index_;
+        --size_;
+        pool_->release(victim);
+        return iterator(pool_, prev.next);
+    }
+
+    /// @brief Moves this list's first node to the back of `dst` (same pool). No allocation, O(1).
+    void move_front_to_back(list &dst) {
+        check_same_pool(dst);
+        sync();
+        dst.sync();
+        if (head_ == npos) throw std::out_of_range("move_front_to_back on an empty list");
+        dst.link_back(unlink_front());
+    }
+
+    /// @brief Moves this list's first node to the front of `dst` (same pool). No allocation, O(1).
+    void move_front_to_front(list &dst) {
+        check_same_pool(dst);
+        sync();
+        dst.sync();
+        if (head_ == npos) throw std::out_of_range("move_front_to_front on an empty list");
+        dst.link_front(unlink_front());
+    }
+
+    /// @brief Appends every node of `other` (same pool) to this list, leaving `other` empty. O(1).
+    void splice_back(list &other) {
+        check_same_pool(other);
+        sync();
+        other.sync();
+        if (&other == this || other.head_ == npos) return;
+        if (tail_ == npos) head_ = other.head_;
+        else pool_->slot(tail_).next = other.head_;
+        tail_ = other.tail_;
+        size_ += other.size_;
+        other.head_ = other.tail_ = npos;
+        other.size_ = 0;
+    }
+
+    /// @brief Prepends every node of `other` (same pool) to this list, leaving `other` empty. O(1).
+    void splice_front(list &other) {
+        check_same_pool(other);
+        other.sync();
+        if (&other == this || other.head_ == npos) return;
+        other.splice_back(*this);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+    }
+
+    // --- HANDLES ---
+
+    /// @brief Returns a generational handle to the element at `pos`. O(1).
+    handle handle_of(const_iterator pos) const {
+        if (pos.index_ == npos) throw std::invalid_argument("Cannot take a handle to the end iterator");
+        return handle{pos.index_, pool_->slot(pos.index_).generation};
+    }
+
+    /// @brief Appends an element and returns a handle to it. O(1).
+    handle push_back_handle(T value) {
+        push_back(std::move(value));
+        return handle{tail_, pool_->slot(tail_).generation};
+    }
+
+    // --- ELEMENT ACCESS ---
+
+    T &front() {
+        sync();
+        if (head_ == npos) throw std::out_of_range("Accessing front() on an empty list");
+        return pool_->slot(head_).value();
+    }
+
+    T &back() {
+        sync();
+        if (tail_ == npos) throw std::out_of_range("Accessing back() on an empty list");
+        return pool_->slot(tail_).value();
+    }
+
+    const T &front() const {
+        if (empty()) throw std::out_of_range("Accessing front() on an empty list");
+        return *const_iterator(pool_, head_);
+    }
+
+    const T &back() const {
+        if (empty()) throw std::out_of_range("Accessing back() on an empty list");
+        return *const_iterator(pool_, tail_);
+    }
+
+    // --- ITERATORS ---
+
+    iterator begin() noexcept { sync(); return iterator(pool_, head_); }
+    iterator end() noexcept { return iterator(pool_, npos); }
+    const_iterator begin() const noexcept { return const_iterator(pool_, empty() ? npos : head_); }
+    const_iterator end() const noexcept { return const_iterator(pool_, npos); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+};
+
+#endif // LIST_POOL_H
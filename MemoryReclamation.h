@@ -0,0 +1,384 @@
+#ifndef MEMORY_RECLAMATION_H
+#define MEMORY_RECLAMATION_H
+
+// Required C++17 for aligned new of the per-participant records
+// Compile with: g++ -std=c++17 -pthread <your_main_file>.cpp
+
+#include <atomic>       // For std::atomic, std::memory_order
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+#include <memory>       // For std::unique_ptr
+#include <mutex>        // For std::mutex, std::lock_guard
+#include <stdexcept>    // For std::length_error, std::logic_error
+#include <vector>       // For std::vector
+#include <algorithm>    // For std::sort, std::binary_search
+
+/**
+ * @brief A node handed to a reclaimer together with the function that frees it.
+ * * Type-erased so a single limbo list can hold nodes of any list type.
+ */
+struct RetiredNode
+{
+    void *ptr;
+    void (*deleter)(void *);
+    std::uint64_t epoch; // Epoch the node was retired in (unused by hazard pointers)
+
+    void reclaim() const { deleter(ptr); }
+};
+
+// --- EPOCH-BASED RECLAMATION ---
+
+/**
+ * @brief Epoch-based memory reclamation (EBR) domain.
+ * * Threads register as participants, pin the current epoch with a `guard`
+ * while they may hold references to shared nodes, and `retire()` nodes after
+ * unlinking them. A retired node is freed once the global epoch has advanced
+ * twice past the epoch it was retired in, which guarantees that no guard
+ * that could have observed it is still alive. Freeing happens in batches to
+ * keep the per-operation overhead to a handful of atomic loads.
+ */
+class EpochReclaimer
+{
+    // One record per participant, padded to a cache line to avoid false sharing.
+    struct alignas(64) Record
+    {
+        std::atomic<bool> claimed{false};
+        std::atomic<std::uint64_t> state{0}; // (epoch << 1) | 1 while pinned, 0 when quiescent
+    };
+
+    std::atomic<std::uint64_t> global_epoch_{2};
+    std::unique_ptr<Record[]> records_;
+    std::size_t max_participants_;
+    std::size_t batch_size_;
+
+    std::mutex orphans_mutex_;
+    std::vector<RetiredNode> orphans_; // Leftovers of participants that have detached
+
+    /// @brief Advances the global epoch if every pinned participant has observed it.
+    bool try_advance() noexcept {
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+        for (std::size_t i = 0; i < max_participants_; ++i) {
+            if (!records_[i].claimed.load(std::memory_order_acquire)) continue;
+            std::uint64_t state = records_[i].state.load(std::memory_order_seq_cst);
+            if ((state & 1) && (state >> 1) != epoch) return false;
+        }
+        return global_epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    }
+
+public:
+    class participant;
+    class guard;
+
+    /**
+     * @brief Creates a reclamation domain.
+     * @param max_participants Maximum number of concurrently registered threads.
+     * @param batch_size Number of retired nodes a participant buffers before it tries to free them.
+     */
+    explicit EpochReclaimer(std::size_t max_participants = 128, std::size_t batch_size = 64)
+        : records_(new Record[max_participants]), max_participants_(max_participants),
+          batch_size_(batch_size ? batch_size : 1) {}
+
+    EpochReclaimer(const EpochReclaimer &) = delete;
+    EpochReclaimer &operator=(const EpochReclaimer &) = delete;
+
+    /// @brief Frees every node still waiting. All participants must have detached.
+    ~EpochReclaimer() {
+        for (const auto &node : orphans_) node.reclaim();
+    }
+
+    /// @brief Returns the current global epoch.
+    std::uint64_t epoch() const noexcept { return global_epoch_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief A thread's registration with an EpochReclaimer.
+     * * Owns the thread's limbo list. Must only be used by the thread that created it.
+     */
+    class participant
+    {
+        EpochReclaimer &domain_;
+        Record *record_;
+        std::vector<RetiredNode> limbo_;
+        std::size_t next_collect_;
+        std::size_t pin_depth_ = 0;
+
+        friend class guard;
+
+        void pin() noexcept {
+            if (pin_depth_++ == 0) {
+                std::uint64_t epoch = domain_.global_epoch_.load(std::memory_order_seq_cst);
+                record_->state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+            }
+        }
+
+        void unpin() noexcept {
+            if (--pin_depth_ == 0) record_->state.store(0, std::memory_order_release);
+        }
+
+    public:
+        /// @brief Registers the calling thread. Throws std::length_error if the domain is full.
+        explicit participant(EpochReclaimer &domain) : domain_(domain), record_(nullptr) {
+            for (std::size_t i = 0; i < domain.max_participants_; ++i) {
+                bool expected = false;
+                if (domain.records_[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                    record_ = &domain.records_[i];
+                    break;
+                }
+            }
+            if (!record_) throw std::length_error("EpochReclaimer: too many participants");
+            next_collect_ = domain.batch_size_;
+            limbo_.reserve(domain.batch_size_);
+        }
+
+        participant(const participant &) = delete;
+        participant &operator=(const participant &) = delete;
+
+        /// @brief Frees what it can and hands the remaining nodes to the domain.
+        ~participant() {
+            collect();
+            if (!limbo_.empty()) {
+                std::lock_guard<std::mutex> lock(domain_.orphans_mutex_);
+                domain_.orphans_.insert(domain_.orphans_.end(), limbo_.begin(), limbo_.end());
+            }
+            record_->state.store(0, std::memory_order_release);
+            record_->claimed.store(false, std::memory_order_release);
+        }
+
+        /**
+         * @brief Schedules a node for deletion once no guard can still observe it.
+         * @param node A node that is no longer reachable from the shared structure.
+         */
+        template <typename U>
+        void retire(U *node) {
+            if (!node) return;
+            limbo_.push_back(RetiredNode{node, [](void *p) { delete static_cast<U *>(p); },
+                                         domain_.global_epoch_.load(std::memory_order_acquire)});
+            if (limbo_.size() >= next_collect_) collect();
+        }
+
+        /// @brief Tries to advance the epoch and frees every node that has become safe.
+        void collect() {
+            domain_.try_advance();
+            std::uint64_t epoch = domain_.global_epoch_.load(std::memory_order_acquire);
+            auto keep = std::partition(limbo_.begin(), limbo_.end(),
+                                       [epoch](const RetiredNode &n) { return n.epoch + 2 > epoch; });
+            for (auto it = keep; it != limbo_.end(); ++it) it->reclaim();
+            limbo_.erase(keep, limbo_.end());
+            // Nodes still held back by a slow guard are rescanned only after another full batch.
+            next_collect_ = limbo_.size() + domain_.batch_size_;
+        }
+
+        /// @brief Returns the number of retired nodes not yet freed.
+        std::size_t pending() const noexcept { return limbo_.size(); }
+    };
+
+    /**
+     * @brief RAII critical section. Nodes reachable while a guard is alive are not freed.
+     * * Guards nest; only the outermost one publishes the epoch.
+     */
+    class guard
+    {
+        participant &owner_;
+
+    public:
+        explicit guard(participant &owner) noexcept : owner_(owner) { owner_.pin(); }
+        ~guard() { owner_.unpin(); }
+        guard(const guard &) = delete;
+        guard &operator=(const guard &) = delete;
+
+        /// @brief No-op: the pinned epoch already protects every node reachable under the guard.
+        template <typename U>
+        void publish(const U *) noexcept {}
+    };
+};
+
+// --- HAZARD POINTERS ---
+
+/**
+ * @brief Hazard-pointer memory reclamation domain.
+ * * An alternative to EpochReclaimer with bounded garbage: each participant
+ * publishes up to `HazardsPerParticipant` pointers it is about to dereference,
+ * and a retired node is freed only when no published hazard points at it.
+ * A stalled thread therefore delays only the nodes it protects, not every
+ * node retired after it.
+ * * @tparam HazardsPerParticipant Number of hazard slots each thread owns.
+ */
+template <std::size_t HazardsPerParticipant = 2>
+class HazardPointerReclaimer
+{
+    struct alignas(64) Record
+    {
+        std::atomic<bool> claimed{false};
+        std::atomic<void *> hazards[HazardsPerParticipant];
+        Record() { for (auto &h : hazards) h.store(nullptr, std::memory_order_relaxed); }
+    };
+
+    std::unique_ptr<Record[]> records_;
+    std::size_t max_participants_;
+    std::size_t batch_size_;
+
+    std::mutex orphans_mutex_;
+    std::vector<RetiredNode> orphans_;
+
+    /// @brief Snapshot of every published hazard, sorted for binary search.
+    std::vector<void *> collect_hazards() const {
+        std::vector<void *> hazards;
+        for (std::size_t i = 0; i < max_participants_; ++i) {
+            if (!records_[i].claimed.load(std::memory_order_acquire)) continue;
+            for (const auto &h : records_[i].hazards) {
+                void *p = h.load(std::memory_order_seq_cst);
+                if (p) hazards.push_back(p);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+        return hazards;
+    }
+
+public:
+    class participant;
+    class guard;
+
+    /**
+     * @brief Creates a reclamation domain.
+     * @param max_participants Maximum number of concurrently registered threads.
+     * @param batch_size Number of retired nodes a participant buffers before it scans the hazards.
+     */
+    explicit HazardPointerReclaimer(std::size_t max_participants = 128, std::size_t batch_size = 64)
+        : records_(new Record[max_participants]), max_participants_(max_participants),
+          batch_size_(batch_size ? batch_size : 1) {}
+
+    HazardPointerReclaimer(const HazardPointerReclaimer &) = delete;
+    HazardPointerReclaimer &operator=(const HazardPointerReclaimer &) = delete;
+
+    /// @brief Frees every node still waiting. All participants must have detached.
+    ~HazardPointerReclaimer() {
+        for (const auto &node : orphans_) node.reclaim();
+    }
+
+    /**
+     * @brief A thread's registration with a HazardPointerReclaimer.
+     * * Owns the thread's hazard slots and retired list. Must only be used by
+     * the thread that created it.
+     */
+    class participant
+    {
+        HazardPointerReclaimer &domain_;
+        Record *record_;
+        std::vector<RetiredNode> retired_;
+        std::size_t next_collect_;
+        std::size_t slots_in_use_ = 0;
+
+        friend class guard;
+
+    public:
+        /// @brief Registers the calling thread. Throws std::length_error if the domain is full.
+        explicit participant(HazardPointerReclaimer &domain) : domain_(domain), record_(nullptr) {
+            for (std::size_t i = 0; i < domain.max_participants_; ++i) {
+                bool expected = false;
+                if (domain.records_[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                    record_ = &domain.records_[i];
+                    break;
+                }
+            }
+            if (!record_) throw std::length_error("HazardPointerReclaimer: too many participants");
+            next_collect_ = domain.batch_size_;
+            retired_.reserve(domain.batch_size_);
+        }
+
+        participant(const participant &) = delete;
+        participant &operator=(const participant &) = delete;
+
+        /// @brief Frees what it can and hands the remaining nodes to the domain.
+        ~participant() {
+            for (auto &h : record_->hazards) h.store(nullptr, std::memory_order_release);
+            collect();
+            if (!retired_.empty()) {
+                std::lock_guard<std::mutex> lock(domain_.orphans_mutex_);
+                domain_.orphans_.insert(domain_.orphans_.end(), retired_.begin(), retired_.end());
+            }
+            record_->claimed.store(false, std::memory_order_release);
+        }
+
+        /**
+         * @brief Schedules a node for deletion once no hazard pointer references it.
+         * @param node A node that is no longer reachable from the shared structure.
+         */
+        template <typename U>
+        void retire(U *node) {
+            if (!node) return;
+            retired_.push_back(RetiredNode{node, [](void *p) { delete static_cast<U *>(p); }, 0});
+            if (retired_.size() >= next_collect_) collect();
+        }
+
+        /// @brief Scans all hazards and frees every retired node that is not protected.
+        void collect() {
+            std::vector<void *> hazards = domain_.collect_hazards();
+            auto keep = std::partition(retired_.begin(), retired_.end(), [&hazards](const RetiredNode &n) {
+                return std::binary_search(hazards.begin(), hazards.end(), n.ptr);
+            });
+            for (auto it = keep; it != retired_.end(); ++it) it->reclaim();
+            retired_.erase(keep, retired_.end());
+            next_collect_ = retired_.size() + domain_.batch_size_;
+        }
+
+        /// @brief Returns the number of retired nodes not yet freed.
+        std::size_t pending() const noexcept { return retired_.size(); }
+    };
+
+    /**
+     * @brief RAII ownership of one hazard slot.
+     * * Slots are taken in stack order; a participant can hold at most
+     * `HazardsPerParticipant` guards at once.
+     */
+    class guard
+    {
+        participant &owner_;
+        std::atomic<void *> *slot_;
+
+    public:
+        /// @brief Claims the participant's next free slot. Throws std::logic_error if none is left.
+        explicit guard(participant &owner) : owner_(owner) {
+            if (owner_.slots_in_use_ == HazardsPerParticipant)
+                throw std::logic_error("HazardPointerReclaimer: no free hazard slot");
+            slot_ = &owner_.record_->hazards[owner_.slots_in_use_++];
+        }
+
+        ~guard() {
+            slot_->store(nullptr, std::memory_order_release);
+            --owner_.slots_in_use_;
+        }
+
+        guard(const guard &) = delete;
+        guard &operator=(const guard &) = delete;
+
+        /**
+         * @brief Loads `src` and publishes it as a hazard, retrying until the value is stable.
+         * @return The protected pointer, safe to dereference until the guard is reset or destroyed.
+         */
+        template <typename U>
+        U *protect(const std::atomic<U *> &src) noexcept {
+            U *p = src.load(std::memory_order_acquire);
+            for (;;) {
+                slot_->store(const_cast<void *>(static_cast<const void *>(p)), std::memory_order_seq_cst);
+                U *again = src.load(std::memory_order_acquire);
+                if (again == p) return p;
+                p = again;
+            }
+        }
+
+        /**
+         * @brief Publishes `node` as a hazard without validating it.
+         * * The caller must guarantee that `node` cannot be retired before the
+         * store becomes visible, typically by holding the lock that serializes it
+         * with writers. The pointer must be the one later passed to `retire()`.
+         */
+        template <typename U>
+        void publish(const U *node) noexcept {
+            slot_->store(const_cast<void *>(static_cast<const void *>(node)), std::memory_order_seq_cst);
+        }
+
+        /// @brief Drops the current protection without releasing the slot.
+        void reset() noexcept { slot_->store(nullptr, std::memory_order_release); }
+    };
+};
+
+#endif // MEMORY_RECLAMATION_H
@@ -0,0 +1,269 @@
+#ifndef NUMA_ARENA_H
+#define NUMA_ARENA_H
+
+// Required C++17 for std::pmr::memory_resource
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+// Linux only for real placement; other platforms get the single-node fallback.
+
+#include <cstddef>          // For std::size_t, std::max_align_t
+#include <cstdint>          // For std::uintptr_t
+#include <memory_resource>  // For std::pmr::memory_resource, std::pmr::synchronized_pool_resource
+#include <new>              // For std::bad_alloc
+#include <stdexcept>        // For std::invalid_argument
+#include <system_error>     // For std::system_error, std::generic_category
+#include <vector>           // For std::vector
+#include <algorithm>        // For std::sort, std::unique
+
+#if defined(__linux__)
+#include <sys/mman.h>       // For mmap, munmap
+#include <sys/syscall.h>    // For SYS_mbind, SYS_move_pages, SYS_getcpu
+#include <unistd.h>         // For syscall, sysconf
+#include <dirent.h>         // For opendir, readdir
+#include <cstring>          // For std::strncmp
+#include <cstdlib>          // For std::atoi
+#include <cerrno>           // For errno
+#endif
+
+#include "SinglyLinkedList.h"
+
+/**
+ * @brief Thin wrappers over the Linux NUMA system calls.
+ * * Raw `syscall()` is used so no libnuma dependency is needed. On single-node
+ * machines and non-Linux platforms every function degrades to a no-op.
+ */
+namespace numa
+{
+#if defined(__linux__)
+    constexpr int mpol_bind = 2;        // MPOL_BIND from <linux/mempolicy.h>
+    constexpr int mpol_mf_move = 1 << 1; // MPOL_MF_MOVE
+#endif
+
+    /// @brief Returns the number of NUMA nodes (1 if unknown).
+    inline int node_count() noexcept {
+#if defined(__linux__)
+        static const int count = [] {
+            int highest = -1;
+            if (DIR *dir = opendir("/sys/devices/system/node")) {
+                while (dirent *entry = readdir(dir)) {
+                    if (std::strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+                        highest = std::max(highest, std::atoi(entry->d_name + 4));
+                }
+                closedir(dir);
+            }
+            return highest < 0 ? 1 : highest + 1;
+        }();
+        return count;
+#else
+        return 1;
+#endif
+    }
+
+    /// @brief Returns the NUMA node of the CPU the calling thread runs on (0 if unknown).
+    inline int local_node() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+        unsigned cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return static_cast<int>(node);
+#endif
+        return 0;
+    }
+
+    /// @brief Returns the system page size.
+    inline std::size_t page_size() noexcept {
+#if defined(__linux__)
+        static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+    /**
+     * @brief Binds a page-aligned range to `node` (mbind with MPOL_BIND).
+     * @return True on success or when there is only one node.
+     */
+    inline bool bind(void *addr, std::size_t bytes, int node) noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+        if (node_count() < 2) return true;
+        constexpr std::size_t bits = 8 * sizeof(unsigned long);
+        std::vector<unsigned long> mask(static_cast<std::size_t>(node) / bits + 1, 0);
+        mask[static_cast<std::size_t>(node) / bits] = 1UL << (static_cast<std::size_t>(node) % bits);
+        return syscall(SYS_mbind, addr, bytes, mpol_bind, mask.data(), mask.size() * bits + 1, mpol_mf_move) == 0;
+#else
+        (void)addr; (void)bytes; (void)node;
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Moves the pages containing `pages` to `node` (move_pages).
+     * @param pages Page-aligned addresses; duplicates are allowed.
+     * @return The number of pages that ended up on `node` (all of them on single-node machines).
+     */
+    inline std::size_t move_to_node(std::vector<void *> pages, int node) noexcept {
+        std::sort(pages.begin(), pages.end());
+        pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+#if defined(__linux__) && defined(SYS_move_pages)
+        if (node_count() < 2 || pages.empty()) return pages.size();
+        std::vector<int> nodes(pages.size(), node), status(pages.size(), -1);
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nodes.data(), status.data(), mpol_mf_move) < 0)
+            return 0;
+        std::size_t moved = 0;
+        for (int s : status) moved += (s == node);
+        return moved;
+#else
+        (void)node;
+        return pages.size();
+#endif
+    }
+}
+
+/**
+ * @brief A bump arena whose chunks are bound to one NUMA node.
+ * * Allocation is a pointer bump inside the current chunk; memory is returned
+ * to the system only when the arena is destroyed or released. Usable anywhere
+ * a `std::pmr::memory_resource` is accepted. Allocation throws
+ * std::system_error if the kernel refuses to bind a new chunk. Not
+ * thread-safe; NumaLayout puts a synchronized pool in front of it.
+ */
+class NumaArena : public std::pmr::memory_resource
+{
+    struct Chunk
+    {
+        void *base;
+        std::size_t bytes;
+    };
+
+    int node_;
+    std::size_t chunk_bytes_;
+    std::vector<Chunk> chunks_;
+    char *cursor_ = nullptr;
+    char *limit_ = nullptr;
+
+    void *map_chunk(std::size_t bytes) {
+        chunks_.reserve(chunks_.size() + 1); // So recording the chunk below cannot throw and leak it
+#if defined(__linux__)
+        void *base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) throw std::bad_alloc();
+        // Binding before first touch makes the kernel fault the pages in on `node_`.
+        if (!numa::bind(base, bytes, node_)) {
+            int error = errno;
+            munmap(base, bytes);
+            throw std::system_error(error, std::generic_category(), "NumaArena: mbind failed");
+        }
+#else
+        void *base = ::operator new(bytes);
+#endif
+        chunks_.push_back(Chunk{base, bytes});
+        return base;
+    }
+
+    static void unmap_chunk(const Chunk &chunk) noexcept {
+#if defined(__linux__)
+        munmap(chunk.base, chunk.bytes);
+#else
+        ::operator delete(chunk.base);
+#endif
+    }
+
+protected:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        std::uintptr_t p = (reinterpret_cast<std::uintptr_t>(cursor_) + alignment - 1) & ~(alignment - 1);
+        if (!cursor_ || p + bytes > reinterpret_cast<std::uintptr_t>(limit_)) {
+            std::size_t page = numa::page_size();
+            std::size_t need = ((std::max(chunk_bytes_, bytes + alignment) + page - 1) / page) * page;
+            cursor_ = static_cast<char *>(map_chunk(need));
+            limit_ = cursor_ + need;
+            p = (reinterpret_cast<std::uintptr_t>(cursor_) + alignment - 1) & ~(alignment - 1);
+        }
+        cursor_ = reinterpret_cast<char *>(p + bytes);
+        return reinterpret_cast<void *>(p);
+    }
+
+    // Individual blocks are not reclaimed; see release().
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+public:
+    /**
+     * @brief Creates an arena bound to a NUMA node.
+     * @param node The node to place memory on; -1 selects the calling thread's local node.
+     * @param chunk_bytes Size of each chunk requested from the kernel.
+     */
+    explicit NumaArena(int node = -1, std::size_t chunk_bytes = 1 << 20)
+        : node_(node < 0 ? numa::local_node() : node), chunk_bytes_(chunk_bytes) {
+        if (node_ >= numa::node_count()) throw std::invalid_argument("NumaArena: no such NUMA node");
+    }
+
+    NumaArena(const NumaArena &) = delete;
+    NumaArena &operator=(const NumaArena &) = delete;
+
+    ~NumaArena() override { release(); }
+
+    /// @brief Returns every chunk to the system. Invalidates all memory handed out.
+    void release() noexcept {
+        for (const auto &chunk : chunks_) unmap_chunk(chunk);
+        chunks_.clear();
+        cursor_ = limit_ = nullptr;
+    }
+
+    /// @brief Returns the node this arena places memory on.
+    int node() const noexcept { return node_; }
+
+    /// @brief Returns the total number of bytes mapped from the kernel.
+    std::size_t mapped_bytes() const noexcept {
+        std::size_t total = 0;
+        for (const auto &chunk : chunks_) total += chunk.bytes;
+        return total;
+    }
+};
+
+/**
+ * @brief Layout policy that allocates a list's nodes on one NUMA node.
+ * * `SinglyLinkedList<T, NumaLayout<1>>` draws every node from a
+ * process-wide NumaArena bound to node 1, behind a
+ * `std::pmr::synchronized_pool_resource` so lists may allocate from
+ * several threads and freed nodes are reused. Lists of all types with the
+ * same `NumaNode` share one arena. The arena lives until static
+ * destruction, so lists of this layout must not have static storage
+ * duration themselves.
+ * * @tparam NumaNode The node to place nodes on; -1 selects the node of the first allocating thread.
+ * @tparam Base The alignment policy to combine with (CompactLayout or CacheAlignedLayout).
+ */
+template <int NumaNode = -1, typename Base = CompactLayout>
+struct NumaLayout : Base
+{
+    /// @brief The arena behind this layout's nodes, for inspection.
+    static NumaArena &arena() {
+        static NumaArena instance(NumaNode);
+        return instance;
+    }
+
+    static std::pmr::memory_resource *node_resource() {
+        static std::pmr::synchronized_pool_resource pool(&arena()); // Constructed after, so destroyed before, the arena
+        return &pool;
+    }
+};
+
+/**
+ * @brief Moves the pages holding a list's elements next to the threads that will consume them.
+ * * Nodes stay where they are in the virtual address space, so iterators and
+ * references remain valid; only the physical pages move. Pages shared with
+ * unrelated allocations move too. O(N) plus the cost of the page migration.
+ * @param list The list whose nodes to migrate.
+ * @param node The destination NUMA node; -1 selects the calling thread's local node.
+ * @return The number of distinct pages now on `node`.
+ */
+template <typename T, typename Layout>
+std::size_t migrate_to_node(const SinglyLinkedList<T, Layout> &list, int node = -1) {
+    if (node < 0) node = numa::local_node();
+    if (node >= numa::node_count()) throw std::invalid_argument("migrate_to_node: no such NUMA node");
+    const std::uintptr_t mask = ~static_cast<std::uintptr_t>(numa::page_size() - 1);
+    std::vector<void *> pages;
+    pages.reserve(list.size());
+    for (const auto &value : list)
+        pages.push_back(reinterpret_cast<void *>(reinterpret_cast<std::uintptr_t>(&value) & mask));
+    return numa::move_to_node(std::move(pages), node);
+}
+
+#endif // NUMA_ARENA_H
@@ -0,0 +1,285 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+// Required C++17 for std::launder
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>      // For std::size_t
+#include <functional>   // For std::less
+#include <iterator>     // For std::make_move_iterator
+#include <memory>       // For std::unique_ptr
+#include <new>          // For placement new, std::launder
+#include <stdexcept>    // For std::out_of_range, std::invalid_argument
+#include <utility>      // For std::move, std::forward, std::swap
+#include <vector>       // For std::vector
+
+/**
+ * @brief A meldable priority queue whose trees are singly linked child and sibling chains.
+ * * Each node links to its first child and its next sibling, like a list
+ * node, plus one back link (its parent if it is a first child, otherwise its
+ * left sibling) so `decrease_key` can cut it out in O(1). `push` and `meld`
+ * link two roots in O(1); `pop` pairs the root's children left to right and
+ * melds the pairs right to left, amortized O(log n).
+ *
+ * Nodes come from fixed-size blocks owned by the heap, recycled through a
+ * free list, so a long run of pushes and pops allocates only when the heap
+ * outgrows every earlier peak. Nodes never move: a `handle` returned by
+ * `push` stays valid until its element is popped, including across `meld`
+ * into another heap and moves of the heap itself.
+ *
+ * `top()` is the element that no other element compares before, i.e. the
+ * minimum under `std::less`. Note this is the opposite of
+ * `std::priority_queue`, which keeps the maximum on top.
+ * * @tparam T The type of the elements.
+ * @tparam Compare Strict weak ordering; the first element in this order is on top.
+ */
+template <typename T, typename Compare = std::less<T>>
+class PairingHeap
+{
+    static constexpr std::size_t block_nodes = 1024;
+
+    struct Node
+    {
+        alignas(T) unsigned char bytes[sizeof(T)];
+        Node *child;   // First child
+        Node *sibling; // Next sibling; links the free list while the node is free
+        Node *prev;    // Parent if first child, else left sibling; null for the root; itself while free
+
+        T &value() noexcept { return *std::launder(reinterpret_cast<T *>(bytes)); }
+    };
+
+    std::vector<std::unique_ptr<Node[]>> blocks_;
+    Node *free_head_ = nullptr;
+    Node *free_tail_ = nullptr; // Kept so meld can splice free lists in O(1)
+    Node *root_ = nullptr;
+    std::size_t size_ = 0;
+    Compare comp_;
+
+    void add_block() {
+        blocks_.push_back(std::unique_ptr<Node[]>(new Node[block_nodes]));
+        Node *block = blocks_.back().get();
+        for (std::size_t i = 0; i < block_nodes; ++i) {
+            block[i].prev = &block[i];
+            block[i].sibling = i + 1 < block_nodes ? &block[i + 1] : free_head_;
+        }
+        if (!free_head_) free_tail_ = &block[block_nodes - 1];
+        free_head_ = block;
+    }
+
+    template <typename... Args>
+    Node *acquire(Args &&...args) {
+        if (!free_head_) add_block();
+        Node *node = free_head_;
+        ::new (static_cast<void *>(node->bytes)) T(std::forward<Args>(args)...); // The node stays free if this throws
+        free_head_ = node->sibling;
+        if (!free_head_) free_tail_ = nullptr;
+        node->child = node->sibling = node->prev = nullptr;
+        return node;
+    }
+
+    void release(Node *node) noexcept {
+        node->value().~T();
+        node->prev = node;
+        node->sibling = free_head_;
+        if (!free_head_) free_tail_ = node;
+        free_head_ = node;
+    }
+
+    /// @brief Links two roots; the loser becomes the winner's first child. Returns the winner, detached. O(1).
+    Node *link(Node *a, Node *b) noexcept {
+        if (comp_(b->value(), a->value())) std::swap(a, b);
+        b->sibling = a->child;
+        if (a->child) a->child->prev = b;
+        b->prev = a;
+        a->child = b;
+        a->sibling = a->prev = nullptr;
+        return a;
+    }
+
+    /// @brief Two-pass pairing of a sibling chain into one tree.
+    Node *combine(Node *first) noexcept {
+        if (!first) return nullptr;
+        // Pass 1: link neighbours in pairs, stacking the winners through their sibling links.
+        Node *pairs = nullptr;
+        while (first) {
+            Node *a = first, *b = first->sibling;
+            if (!b) {
+                a->sibling = pairs;
+                pairs = a;
+                break;
+            }
+            first = b->sibling;
+            Node *winner = link(a, b);
+            winner->sibling = pairs;
+            pairs = winner;
+        }
+        // Pass 2: meld the stack, i.e. the pairs from right to left.
+        Node *root = pairs;
+        pairs = pairs->sibling;
+        root->sibling = nullptr;
+        while (pairs) {
+            Node *next = pairs->sibling;
+            root = link(root, pairs);
+            pairs = next;
+        }
+        root->prev = nullptr;
+        return root;
+    }
+
+    /// @brief Detaches a non-root node, with its subtree, from its parent's child chain. O(1).
+    void cut(Node *node) noexcept {
+        if (node->prev->child == node) node->prev->child = node->sibling;
+        else node->prev->sibling = node->sibling;
+        if (node->sibling) node->sibling->prev = node->prev;
+        node->sibling = node->prev = nullptr;
+    }
+
+    void destroy_live() noexcept {
+        if (size_ == 0) return;
+        for (auto &block : blocks_)
+            for (std::size_t i = 0; i < block_nodes; ++i)
+                if (block[i].prev != &block[i]) release(&block[i]);
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+public:
+    /**
+     * @brief Refers to one element for `decrease_key` and `value`. Valid until that element is popped.
+     */
+    class handle
+    {
+        Node *node_ = nullptr;
+        friend class PairingHeap;
+        explicit handle(Node *node) noexcept : node_(node) {}
+
+    public:
+        handle() = default;
+        bool operator==(const handle &other) const noexcept { return node_ == other.node_; }
+        bool operator!=(const handle &other) const noexcept { return node_ != other.node_; }
+    };
+
+    // --- LIFECYCLE ---
+
+    /// @brief Creates an empty heap ordered by `comp`.
+    explicit PairingHeap(Compare comp = Compare()) : comp_(std::move(comp)) {}
+
+    /// @brief Destroys the remaining elements and frees the node blocks.
+    ~PairingHeap() { destroy_live(); }
+
+    // Handles point into the blocks, so copying would leave them referring to the source.
+    PairingHeap(const PairingHeap &) = delete;
+    PairingHeap &operator=(const PairingHeap &) = delete;
+
+    /// @brief Move constructor. Handles keep referring to the same elements, now in this heap.
+    PairingHeap(PairingHeap &&other) noexcept
+        : blocks_(std::move(other.blocks_)), free_head_(other.free_head_), free_tail_(other.free_tail_),
+          root_(other.root_), size_(other.size_), comp_(std::move(other.comp_)) {
+        other.blocks_.clear();
+        other.free_head_ = other.free_tail_ = other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    /// @brief Move assignment (swap idiom).
+    PairingHeap &operator=(PairingHeap &&other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    friend void swap(PairingHeap &a, PairingHeap &b) noexcept {
+        using std::swap;
+        swap(a.blocks_, b.blocks_);
+        swap(a.free_head_, b.free_head_);
+        swap(a.free_tail_, b.free_tail_);
+        swap(a.root_, b.root_);
+        swap(a.size_, b.size_);
+        swap(a.comp_, b.comp_);
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Makes room for at least `n` elements in total without further allocation.
+    void reserve(std::size_t n) {
+        while (blocks_.size() * block_nodes < n) add_block();
+    }
+
+    // --- MODIFIERS ---
+
+    /// @brief Inserts an element. Returns a handle to it. O(1).
+    handle push(const T &value) { return emplace(value); }
+    handle push(T &&value) { return emplace(std::move(value)); }
+
+    template <typename... Args>
+    handle emplace(Args &&...args) {
+        Node *node = acquire(std::forward<Args>(args)...);
+        root_ = root_ ? link(root_, node) : node;
+        ++size_;
+        return handle(node);
+    }
+
+    /// @brief Removes the top element. Amortized O(log n).
+    void pop() {
+        if (!root_) throw std::out_of_range("pop on an empty heap");
+        Node *old = root_;
+        root_ = combine(old->child);
+        release(old);
+        --size_;
+    }
+
+    /**
+     * @brief Replaces the value behind `h` with one that compares no later. O(1), amortized O(log n) on the next pop.
+     * * The node is cut from its parent and linked with the root; its own
+     * subtree comes along untouched. A first child that still does not beat
+     * its parent stays where it is. Throws std::invalid_argument if `value`
+     * compares after the current value.
+     */
+    void decrease_key(handle h, T value) {
+        Node *node = h.node_;
+        if (comp_(node->value(), value)) throw std::invalid_argument("decrease_key: new value compares after the old one");
+        node->value() = std::move(value);
+        if (node == root_) return;
+        // A first child that still does not beat its parent leaves the heap order intact.
+        if (node->prev->child == node && !comp_(node->value(), node->prev->value())) return;
+        cut(node);
+        root_ = link(root_, node);
+    }
+
+    /**
+     * @brief Moves every element of `other` into this heap, leaving it empty. O(1) plus one step per node block.
+     * * The node blocks move too, so handles into `other` now refer to this heap.
+     */
+    void meld(PairingHeap &other) {
+        if (this == &other || other.blocks_.empty()) return;
+        blocks_.reserve(blocks_.size() + other.blocks_.size());
+        blocks_.insert(blocks_.end(), std::make_move_iterator(other.blocks_.begin()),
+                       std::make_move_iterator(other.blocks_.end()));
+        other.blocks_.clear();
+        if (other.free_head_) {
+            other.free_tail_->sibling = free_head_;
+            if (!free_head_) free_tail_ = other.free_tail_;
+            free_head_ = other.free_head_;
+        }
+        if (other.root_) root_ = root_ ? link(root_, other.root_) : other.root_;
+        size_ += other.size_;
+        other.free_head_ = other.free_tail_ = other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    /// @brief Destroys every element, keeping the node blocks for reuse. O(capacity).
+    void clear() noexcept { destroy_live(); }
+
+    // --- ELEMENT ACCESS ---
+
+    const T &top() const {
+        if (!root_) throw std::out_of_range("Accessing top() on an empty heap");
+        return root_->value();
+    }
+
+    /// @brief Returns the current value of the element behind `h`. O(1).
+    const T &value(handle h) const noexcept { return h.node_->value(); }
+};
+
+#endif // PAIRING_HEAP_H
@@ -0,0 +1,219 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+// Required C++17 for std::launder
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>      // For std::size_t
+#include <limits>       // For std::numeric_limits
+#include <memory>       // For std::unique_ptr
+#include <new>          // For placement new, std::launder
+#include <stdexcept>    // For std::out_of_range, std::invalid_argument
+#include <type_traits>  // For std::is_integral_v, std::is_unsigned_v
+#include <utility>      // For std::move, std::forward, std::swap
+#include <vector>       // For std::vector
+
+/**
+ * @brief A monotone priority queue: buckets of singly linked nodes keyed by the highest bit that differs from the last key taken.
+ * * Bucket 0 holds keys equal to `last_key()`; bucket `b` holds keys whose
+ * highest bit differing from it is bit `b - 1`. When bucket 0 runs dry, the
+ * minimum of the first non-empty bucket (tracked as nodes arrive) becomes
+ * the new `last_key()`, and that bucket's nodes are relinked into lower
+ * buckets in one pass. Each node
+ * moves down at most once per key bit, so operations are amortized
+ * O(log C) for keys spanning C, and elements are never copied or moved
+ * after `push`. Nodes come from fixed-size blocks recycled through a free
+ * list.
+ *
+ * The heap is monotone: every pushed key must be at least `last_key()`, the
+ * key most recently returned by `top_key()`, `top()` or `pop()`. That fits
+ * event simulations and Dijkstra, where nothing is scheduled in the past.
+ * Elements with equal keys come out in no particular order.
+ * * @tparam Key Unsigned integer priority; the smallest key is on top.
+ * @tparam T The type of the payload.
+ */
+template <typename Key, typename T>
+class RadixHeap
+{
+    static_assert(std::is_integral_v<Key> && std::is_unsigned_v<Key>, "RadixHeap keys must be unsigned integers");
+
+    static constexpr std::size_t block_nodes = 1024;
+    static constexpr std::size_t bucket_count = std::numeric_limits<Key>::digits + 1;
+
+    struct Node
+    {
+        Key key;
+        Node *next; // Next node in the bucket, or in the free list while free
+        alignas(T) unsigned char bytes[sizeof(T)];
+
+        T &value() noexcept { return *std::launder(reinterpret_cast<T *>(bytes)); }
+    };
+
+    std::vector<std::unique_ptr<Node[]>> blocks_;
+    Node *free_head_ = nullptr;
+    Node *buckets_[bucket_count] = {};
+    Key bucket_min_[bucket_count] = {}; // Smallest key in each non-empty bucket, so a refill walks its chain once
+    Key last_ = 0;
+    std::size_t size_ = 0;
+
+    /// @brief Number of significant bits in `x`, i.e. one more than the index of its highest set bit.
+    static std::size_t bit_width(Key x) noexcept {
+#if defined(__GNUC__)
+        return x ? std::size_t(std::numeric_limits<unsigned long long>::digits - __builtin_clzll(x)) : 0;
+#else
+        std::size_t width = 0;
+        for (; x; x >>= 1) ++width;
+        return width;
+#endif
+    }
+
+    std::size_t bucket_of(Key key) const noexcept { return bit_width(key ^ last_); }
+
+    void add_block() {
+        blocks_.push_back(std::unique_ptr<Node[]>(new Node[block_nodes]));
+        Node *block = blocks_.back().get();
+        for (std::size_t i = 0; i < block_nodes; ++i) block[i].next = i + 1 < block_nodes ? &block[i + 1] : free_head_;
+        free_head_ = block;
+    }
+
+    template <typename... Args>
+    Node *acquire(Key key, Args &&...args) {
+        if (!free_head_) add_block();
+        Node *node = free_head_;
+        ::new (static_cast<void *>(node->bytes)) T(std::forward<Args>(args)...); // The node stays free if this throws
+        free_head_ = node->next;
+        node->key = key;
+        return node;
+    }
+
+    void release(Node *node) noexcept {
+        node->value().~T();
+        node->next = free_head_;
+        free_head_ = node;
+    }
+
+    /// @brief Pushes a node onto the front of its bucket's chain.
+    void link(Node *node) noexcept {
+        std::size_t b = bucket_of(node->key);
+        if (!buckets_[b] || node->key < bucket_min_[b]) bucket_min_[b] = node->key;
+        node->next = buckets_[b];
+        buckets_[b] = node;
+    }
+
+    /// @brief Refills bucket 0 from the first non-empty bucket, advancing last_ to the minimum key. Requires size_ > 0.
+    void refill() noexcept {
+        if (buckets_[0]) return;
+        std::size_t b = 1;
+        while (!buckets_[b]) ++b;
+        Node *chain = buckets_[b];
+        buckets_[b] = nullptr;
+        last_ = bucket_min_[b];
+        // Every key in the chain now differs from last_ below bit b - 1, so each lands in a lower bucket.
+        while (chain) {
+            Node *next = chain->next;
+            link(chain);
+            chain = next;
+        }
+    }
+
+    void destroy_live() noexcept {
+        for (Node *&head : buckets_) {
+            while (head) {
+                Node *next = head->next;
+                release(head);
+                head = next;
+            }
+        }
+        size_ = 0;
+    }
+
+public:
+    using key_type = Key;
+    using value_type = T;
+
+    // --- LIFECYCLE ---
+
+    RadixHeap() = default;
+
+    /// @brief Destroys the remaining elements and frees the node blocks.
+    ~RadixHeap() { destroy_live(); }
+
+    RadixHeap(const RadixHeap &) = delete;
+    RadixHeap &operator=(const RadixHeap &) = delete;
+
+    /// @brief Move constructor. The source is left empty.
+    RadixHeap(RadixHeap &&other) noexcept : RadixHeap() { swap(*this, other); }
+
+    /// @brief Move assignment (swap idiom).
+    RadixHeap &operator=(RadixHeap &&other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    friend void swap(RadixHeap &a, RadixHeap &b) noexcept {
+        using std::swap;
+        swap(a.blocks_, b.blocks_);
+        swap(a.free_head_, b.free_head_);
+        swap(a.buckets_, b.buckets_);
+        swap(a.bucket_min_, b.bucket_min_);
+        swap(a.last_, b.last_);
+        swap(a.size_, b.size_);
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Makes room for at least `n` elements in total without further allocation.
+    void reserve(std::size_t n) {
+        while (blocks_.size() * block_nodes < n) add_block();
+    }
+
+    /// @brief Returns the lower bound for pushed keys: the key most recently taken from the top.
+    Key last_key() const noexcept { return last_; }
+
+    // --- MODIFIERS ---
+
+    /// @brief Inserts `value` with priority `key`. Throws std::invalid_argument if `key < last_key()`. O(1).
+    void push(Key key, const T &value) { emplace(key, value); }
+    void push(Key key, T &&value) { emplace(key, std::move(value)); }
+
+    template <typename... Args>
+    void emplace(Key key, Args &&...args) {
+        if (key < last_) throw std::invalid_argument("RadixHeap: key is below the last key taken");
+        link(acquire(key, std::forward<Args>(args)...));
+        ++size_;
+    }
+
+    /// @brief Removes an element with the smallest key. Amortized O(log C).
+    void pop() {
+        if (size_ == 0) throw std::out_of_range("pop on an empty heap");
+        refill();
+        Node *node = buckets_[0];
+        buckets_[0] = node->next;
+        release(node);
+        --size_;
+    }
+
+    /// @brief Destroys every element, keeping the node blocks for reuse. `last_key()` is unchanged.
+    void clear() noexcept { destroy_live(); }
+
+    // --- ELEMENT ACCESS ---
+
+    /// @brief Returns the smallest key, advancing `last_key()` to it. Amortized O(log C).
+    Key top_key() {
+        if (size_ == 0) throw std::out_of_range("Accessing top_key() on an empty heap");
+        refill();
+        return last_;
+    }
+
+    /// @brief Returns the payload of an element with the smallest key, advancing `last_key()` to that key.
+    T &top() {
+        if (size_ == 0) throw std::out_of_range("Accessing top() on an empty heap");
+        refill();
+        return buckets_[0]->value();
+    }
+};
+
+#endif // RADIX_HEAP_H
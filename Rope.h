@@ -0,0 +1,216 @@
+#ifndef ROPE_H
+#define ROPE_H
+
+// Required C++17 for std::string_view
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+// POSIX only: write_to() uses writev.
+
+#include <cstddef>       // For std::size_t
+#include <cerrno>        // For errno, EINTR
+#include <memory>        // For std::unique_ptr, std::make_unique
+#include <string>        // For std::string
+#include <string_view>   // For std::string_view
+#include <vector>        // For std::vector
+#include <algorithm>     // For std::max, std::min
+#include <system_error>  // For std::system_error, std::generic_category
+#include <utility>       // For std::move, std::swap
+#include <limits.h>      // For IOV_MAX
+#include <sys/uio.h>     // For writev, struct iovec
+
+/**
+ * @brief A string builder made of a singly linked chain of byte chunks.
+ * * `append` copies into the spare capacity of the last chunk, or links a
+ * new chunk of at least `chunk_size` bytes, so bytes already written are
+ * never moved again. Ropes concatenate in O(1) by splicing one chain onto
+ * the other's tail. The result leaves either through `write_to(fd)`, which
+ * hands the chunks to `writev` without joining them, or through `flatten()`,
+ * which joins them with exactly one allocation.
+ */
+class Rope
+{
+private:
+    struct Chunk
+    {
+        std::string bytes;
+        std::size_t limit; // Bytes may grow up to this without reallocating
+        std::unique_ptr<Chunk> next;
+
+        Chunk(std::string b, std::size_t l) : bytes(std::move(b)), limit(l), next(nullptr) {}
+    };
+
+    std::unique_ptr<Chunk> head_; // Smart pointer to the first chunk
+    Chunk *tail_;                 // Raw pointer to the last chunk for O(1) append
+    std::size_t size_;            // Total bytes
+    std::size_t chunk_count_;
+    std::size_t chunk_size_;      // Capacity reserved for each new chunk
+
+    void link_back(std::unique_ptr<Chunk> chunk) noexcept {
+        Chunk *raw = chunk.get();
+        (tail_ ? tail_->next : head_) = std::move(chunk);
+        tail_ = raw;
+        ++chunk_count_;
+    }
+
+    bool fits_tail(std::size_t n) const noexcept { return tail_ && tail_->limit - tail_->bytes.size() >= n; }
+
+public:
+    static constexpr std::size_t default_chunk_size = 4096;
+
+    // --- LIFECYCLE ---
+
+    /// @brief Creates an empty rope whose new chunks reserve `chunk_size` bytes.
+    explicit Rope(std::size_t chunk_size = default_chunk_size) noexcept
+        : head_(nullptr), tail_(nullptr), size_(0), chunk_count_(0), chunk_size_(chunk_size ? chunk_size : 1) {}
+
+    /// @brief Destructor. Frees the chunks without recursing once per node.
+    ~Rope() { clear(); }
+
+    /// @brief Copy constructor. Copies the chunks as they are.
+    Rope(const Rope &other) : Rope(other.chunk_size_) {
+        for (const Chunk *c = other.head_.get(); c; c = c->next.get()) {
+            std::string copy;
+            copy.reserve(c->limit);
+            copy = c->bytes;
+            link_back(std::make_unique<Chunk>(std::move(copy), c->limit));
+        }
+        size_ = other.size_;
+    }
+
+    /// @brief Move constructor.
+    Rope(Rope &&other) noexcept
+        : head_(std::move(other.head_)), tail_(other.tail_), size_(other.size_),
+          chunk_count_(other.chunk_count_), chunk_size_(other.chunk_size_) {
+        other.tail_ = nullptr;
+        other.size_ = other.chunk_count_ = 0;
+    }
+
+    /// @brief Copy/move assignment (copy-and-swap idiom).
+    Rope &operator=(Rope other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    friend void swap(Rope &a, Rope &b) noexcept {
+        using std::swap;
+        swap(a.head_, b.head_);
+        swap(a.tail_, b.tail_);
+        swap(a.size_, b.size_);
+        swap(a.chunk_count_, b.chunk_count_);
+        swap(a.chunk_size_, b.chunk_size_);
+    }
+
+    // --- CAPACITY ---
+
+    /// @brief Returns the total number of bytes. O(1).
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    /// @brief Returns the number of chunks, i.e. the iovecs `write_to` submits. O(1).
+    std::size_t chunks() const noexcept { return chunk_count_; }
+
+    // --- MODIFIERS ---
+
+    /**
+     * @brief Appends the bytes of `s`. O(|s|), never moving bytes already in the rope.
+     * * Fills the last chunk's spare capacity first; if `s` does not fit, it
+     * goes whole into a new chunk of `max(chunk_size, |s|)` bytes.
+     */
+    Rope &append(std::string_view s) {
+        if (s.empty()) return *this;
+        if (fits_tail(s.size())) {
+            tail_->bytes.append(s.data(), s.size());
+        } else {
+            std::size_t limit = std::max(chunk_size_, s.size());
+            std::string bytes;
+            bytes.reserve(limit);
+            bytes.append(s.data(), s.size());
+            link_back(std::make_unique<Chunk>(std::move(bytes), limit));
+        }
+        size_ += s.size();
+        return *this;
+    }
+
+    Rope &append(const char *s) { return append(std::string_view(s)); }
+
+    /// @brief Appends a string, adopting its buffer as a chunk instead of copying when it does not fit the last chunk.
+    Rope &append(std::string &&s) {
+        if (s.empty()) return *this;
+        if (fits_tail(s.size())) return append(std::string_view(s));
+        size_ += s.size();
+        std::size_t limit = s.capacity();
+        link_back(std::make_unique<Chunk>(std::move(s), limit));
+        return *this;
+    }
+
+    /// @brief Moves every chunk of `other` onto the end of this rope, leaving `other` empty. O(1).
+    Rope &append(Rope &&other) noexcept {
+        if (this == &other || !other.head_) return *this;
+        (tail_ ? tail_->next : head_) = std::move(other.head_);
+        tail_ = other.tail_;
+        size_ += other.size_;
+        chunk_count_ += other.chunk_count_;
+        other.tail_ = nullptr;
+        other.size_ = other.chunk_count_ = 0;
+        return *this;
+    }
+
+    Rope &operator+=(std::string_view s) { return append(s); }
+    Rope &operator+=(const char *s) { return append(std::string_view(s)); }
+    Rope &operator+=(std::string &&s) { return append(std::move(s)); }
+    Rope &operator+=(Rope &&other) noexcept { return append(std::move(other)); }
+
+    /// @brief Removes all bytes. O(chunks).
+    void clear() noexcept {
+        while (head_) head_ = std::move(head_->next);
+        tail_ = nullptr;
+        size_ = chunk_count_ = 0;
+    }
+
+    // --- OUTPUT ---
+
+    /// @brief Calls `f(std::string_view)` on each chunk in order.
+    template <typename F>
+    void for_each_chunk(F f) const {
+        for (const Chunk *c = head_.get(); c; c = c->next.get()) f(std::string_view(c->bytes));
+    }
+
+    /// @brief Joins the chunks into one string with a single allocation. O(size).
+    std::string flatten() const {
+        std::string out;
+        out.reserve(size_);
+        for (const Chunk *c = head_.get(); c; c = c->next.get()) out.append(c->bytes);
+        return out;
+    }
+
+    /**
+     * @brief Writes every byte to `fd` with `writev`, IOV_MAX chunks per call. O(chunks) syscalls at worst.
+     * * Retries on EINTR and resumes after partial writes; any other failure
+     * throws std::system_error.
+     * @return The number of bytes written, always `size()`.
+     */
+    std::size_t write_to(int fd) const {
+        std::vector<struct iovec> iov;
+        iov.reserve(chunk_count_);
+        for (const Chunk *c = head_.get(); c; c = c->next.get())
+            iov.push_back({const_cast<char *>(c->bytes.data()), c->bytes.size()});
+        std::size_t i = 0;
+        while (i < iov.size()) {
+            ssize_t n = ::writev(fd, iov.data() + i, int(std::min<std::size_t>(iov.size() - i, IOV_MAX)));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::system_error(errno, std::generic_category(), "Rope::write_to");
+            }
+            for (std::size_t left = std::size_t(n); left > 0;) {
+                if (left >= iov[i].iov_len) {
+                    left -= iov[i++].iov_len;
+                } else {
+                    iov[i].iov_base = static_cast<char *>(iov[i].iov_base) + left;
+                    iov[i].iov_len -= left;
+                    left = 0;
+                }
+            }
+        }
+        return size_;
+    }
+};
+
+#endif // ROPE_H
@@ -0,0 +1,269 @@
+#ifndef RUN_LENGTH_LIST_H
+#define RUN_LENGTH_LIST_H
+
+// Required C++17
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <memory>           // For std::unique_ptr, std::make_unique
+#include <stdexcept>        // For std::out_of_range, std::invalid_argument
+#include <cstddef>          // For std::size_t, std::ptrdiff_t
+#include <iterator>         // For std::forward_iterator_tag, std::next
+#include <utility>          // For std::move, std::swap
+#include <initializer_list> // For std::initializer_list constructor
+
+/**
+ * @brief A singly linked list that stores runs of equal elements as one (value, count) node.
+ * * Iteration yields every logical element, and `size()` counts logical
+ * elements in O(1), so it reads like a plain list. Long runs (status streams,
+ * sparse flags) cost one node instead of one per repeat. Adjacent runs always
+ * hold different values: `push_back` extends the last run, `insert_after`
+ * splits a run when needed and `erase_after` merges runs that become equal.
+ * Elements are read-only through iterators; a run's value is shared by all
+ * its elements. Modifiers may invalidate iterators into the runs they touch.
+ * * @tparam T The type of the elements. Must be equality comparable.
+ */
+template <typename T>
+class RunLengthList
+{
+private:
+    struct Run
+    {
+        T value;
+        std::size_t count;
+        std::unique_ptr<Run> next;
+
+        Run(T v, std::size_t n) : value(std::move(v)), count(n), next(nullptr) {}
+    };
+
+    std::unique_ptr<Run> head_; // Smart pointer to the first run
+    Run *tail_;                 // Raw pointer to the last run for O(1) push_back
+    std::size_t list_size;      // Logical elements
+    std::size_t run_count;      // Nodes
+
+    /// @brief Links `run` after `prev`, or at the front if `prev` is null.
+    Run *link_after(Run *prev, std::unique_ptr<Run> run) noexcept {
+        Run *raw = run.get();
+        std::unique_ptr<Run> &slot = prev ? prev->next : head_;
+        run->next = std::move(slot);
+        slot = std::move(run);
+        if (tail_ == prev) tail_ = raw;
+        ++run_count;
+        return raw;
+    }
+
+    /// @brief Unlinks the run after `prev` (the head if null), merging its neighbours if they now match.
+    void unlink_after(Run *prev) noexcept {
+        std::unique_ptr<Run> &slot = prev ? prev->next : head_;
+        std::unique_ptr<Run> old = std::move(slot);
+        slot = std::move(old->next);
+        if (tail_ == old.get()) tail_ = prev;
+        --run_count;
+        if (prev && prev->next && prev->next->value == prev->value) {
+            prev->count += prev->next->count;
+            std::unique_ptr<Run> merged = std::move(prev->next);
+            prev->next = std::move(merged->next);
+            if (tail_ == merged.get()) tail_ = prev;
+            --run_count;
+        }
+    }
+
+public:
+    /**
+     * @brief A forward iterator over logical elements: a run and an offset inside it.
+     */
+    class const_iterator
+    {
+        const Run *run_;
+        std::size_t offset_;
+        friend class RunLengthList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        explicit const_iterator(const Run *run = nullptr, std::size_t offset = 0) : run_(run), offset_(offset) {}
+
+        reference operator*() const { return run_->value; }
+        pointer operator->() const { return &run_->value; }
+        const_iterator &operator++() {
+            if (++offset_ == run_->count) {
+                run_ = run_->next.get();
+                offset_ = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+
+        /// @brief Returns how many elements, including this one, remain in the current run.
+        std::size_t run_remaining() const { return run_->count - offset_; }
+
+        bool operator==(const const_iterator &other) const { return run_ == other.run_ && offset_ == other.offset_; }
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+    };
+
+    using iterator = const_iterator;
+
+    // --- LIFECYCLE ---
+
+    /// @brief Default constructor. Creates an empty list.
+    RunLengthList() noexcept : head_(nullptr), tail_(nullptr), list_size(0), run_count(0) {}
+
+    /// @brief Destructor. Frees the runs without recursing once per node.
+    ~RunLengthList() { clear(); }
+
+    /// @brief Copy constructor. Copies runs, not elements.
+    RunLengthList(const RunLengthList &other) : RunLengthList() {
+        for (const Run *run = other.head_.get(); run; run = run->next.get()) push_back(run->value, run->count);
+    }
+
+    /// @brief Move constructor.
+    RunLengthList(RunLengthList &&other) noexcept
+        : head_(std::move(other.head_)), tail_(other.tail_), list_size(other.list_size), run_count(other.run_count) {
+        other.tail_ = nullptr;
+        other.list_size = other.run_count = 0;
+    }
+
+    /// @brief Initializer list constructor.
+    RunLengthList(std::initializer_list<T> ilist) : RunLengthList() {
+        for (const auto &value : ilist) push_back(value);
+    }
+
+    /// @brief Copy/move assignment (copy-and-swap idiom).
+    RunLengthList &operator=(RunLengthList other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    friend void swap(RunLengthList &a, RunLengthList &b) noexcept {
+        using std::swap;
+        swap(a.head_, b.head_);
+        swap(a.tail_, b.tail_);
+        swap(a.list_size, b.list_size);
+        swap(a.run_count, b.run_count);
+    }
+
+    // --- CAPACITY ---
+
+    /// @brief Returns the number of logical elements. O(1).
+    std::size_t size() const noexcept { return list_size; }
+    bool empty() const noexcept { return list_size == 0; }
+    /// @brief Returns the number of runs, i.e. nodes actually allocated. O(1).
+    std::size_t runs() const noexcept { return run_count; }
+
+    // --- MODIFIERS ---
+
+    /// @brief Removes all elements. O(runs).
+    void clear() noexcept {
+        while (head_) head_ = std::move(head_->next);
+        tail_ = nullptr;
+        list_size = run_count = 0;
+    }
+
+    /// @brief Appends `count` copies of `value`, extending the last run if it holds the same value. O(1).
+    void push_back(const T &value, std::size_t count = 1) {
+        if (count == 0) return;
+        if (tail_ && tail_->value == value) tail_->count += count;
+        else link_after(tail_, std::make_unique<Run>(value, count));
+        list_size += count;
+    }
+
+    /// @brief Prepends `count` copies of `value`, extending the first run if it holds the same value. O(1).
+    void push_front(const T &value, std::size_t count = 1) {
+        if (count == 0) return;
+        if (head_ && head_->value == value) head_->count += count;
+        else link_after(nullptr, std::make_unique<Run>(value, count));
+        list_size += count;
+    }
+
+    /// @brief Removes the first element. O(1).
+    void pop_front() {
+        if (!head_) throw std::out_of_range("pop_front on an empty list");
+        if (--head_->count == 0) unlink_after(nullptr);
+        --list_size;
+    }
+
+    /**
+     * @brief Inserts `value` after the element at `pos`. O(1).
+     * * Joins the run at `pos` or the next run when the value matches;
+     * otherwise adds a run, splitting the run at `pos` in two if `pos` is
+     * inside it.
+     * @return An iterator to the inserted element.
+     */
+    iterator insert_after(const_iterator pos, const T &value) {
+        Run *run = const_cast<Run *>(pos.run_);
+        if (!run) throw std::invalid_argument("Cannot insert_after the end iterator");
+        iterator result;
+        if (run->value == value) {
+            ++run->count;
+            result = iterator(run, pos.offset_ + 1);
+        } else if (pos.offset_ + 1 == run->count) {
+            if (run->next && run->next->value == value) ++run->next->count;
+            else link_after(run, std::make_unique<Run>(value, 1));
+            result = iterator(run->next.get(), 0);
+        } else {
+            // Split: [run: offset + 1] [value] [rest of run].
+            auto rest = std::make_unique<Run>(run->value, run->count - pos.offset_ - 1);
+            auto single = std::make_unique<Run>(value, 1);
+            run->count = pos.offset_ + 1;
+            link_after(link_after(run, std::move(single)), std::move(rest));
+            result = iterator(run->next.get(), 0);
+        }
+        ++list_size;
+        return result;
+    }
+
+    /**
+     * @brief Erases the element after `pos`. O(1).
+     * * Shrinks the run holding it; a run that empties is unlinked and its
+     * neighbours merged if they hold the same value.
+     * @return An iterator to the element that followed the erased one.
+     */
+    iterator erase_after(const_iterator pos) {
+        Run *run = const_cast<Run *>(pos.run_);
+        if (!run) throw std::invalid_argument("Cannot erase_after the end iterator");
+        if (pos.offset_ + 1 < run->count) {
+            --run->count;
+        } else {
+            if (!run->next) throw std::out_of_range("erase_after: no element after the given position");
+            if (--run->next->count == 0) unlink_after(run);
+        }
+        --list_size;
+        return std::next(iterator(run, pos.offset_));
+    }
+
+    // --- ELEMENT ACCESS ---
+
+    const T &front() const {
+        if (!head_) throw std::out_of_range("Accessing front() on an empty list");
+        return head_->value;
+    }
+
+    const T &back() const {
+        if (!tail_) throw std::out_of_range("Accessing back() on an empty list");
+        return tail_->value;
+    }
+
+    // --- ITERATORS ---
+
+    const_iterator begin() const { return const_iterator(head_.get()); }
+    const_iterator cbegin() const { return const_iterator(head_.get()); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cend() const { return const_iterator(); }
+
+    // --- COMPARISON ---
+
+    /// @brief Checks if two lists hold the same logical sequence. O(runs), since runs are kept maximal.
+    friend bool operator==(const RunLengthList &lhs, const RunLengthList &rhs) {
+        if (lhs.list_size != rhs.list_size || lhs.run_count != rhs.run_count) return false;
+        for (const Run *a = lhs.head_.get(), *b = rhs.head_.get(); a; a = a->next.get(), b = b->next.get())
+            if (a->count != b->count || !(a->value == b->value)) return false;
+        return true;
+    }
+
+    friend bool operator!=(const RunLengthList &lhs, const RunLengthList &rhs) { return !(lhs == rhs); }
+};
+
+#endif // RUN_LENGTH_LIST_H
@@ -11,6 +11,159 @@
 #include <utility>      // For std::move, std::forward, std::in_place, std::in_place_t
 #include <initializer_list> // For std::initializer_list constructor
 #include <algorithm>    // For std::equal, std::lexicographical_compare
+#include <functional>   // For std::less, std::hash, std::equal_to
+#include <vector>       // For the back-poppable checkpoint trail
+#include <cmath>        // For std::sqrt
+#include <cstdint>      // For std::uint64_t
+#include <new>          // For std::align_val_t
+#include <type_traits>  // For std::void_t
+
+// Cache line size used by CacheAlignedLayout. Override for targets with 128-byte lines.
+#ifndef SLL_CACHE_LINE_SIZE
+#define SLL_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * @brief Default layout policy: members and nodes use their natural alignment.
+ */
+struct CompactLayout
+{
+    static constexpr std::size_t member_alignment = 1; // Raised to the natural alignment by the list
+    static constexpr std::size_t node_alignment = 1;
+};
+
+/**
+ * @brief Layout policy that gives `head_`, `tail_` and `list_size` a cache line each.
+ * * Stops threads that touch different ends of one list, or adjacent lists in
+ * an array, from invalidating each other's cache lines (false sharing).
+ * * @tparam AlignNodes Also align and pad every node to a cache line. Costs
+ *   memory for small `T` but keeps neighbouring nodes off shared lines.
+ */
+template <bool AlignNodes = false>
+struct CacheAlignedLayout
+{
+    static constexpr std::size_t member_alignment = SLL_CACHE_LINE_SIZE;
+    static constexpr std::size_t node_alignment = AlignNodes ? SLL_CACHE_LINE_SIZE : 1;
+};
+
+namespace sll_detail
+{
+    /**
+     * @brief Destroys a detached chain of nodes linked by `std::unique_ptr<Node> next`, front to back.
+     * * Letting the unique_ptr chain destroy itself recurses once per node and
+     * overflows the stack on lists of a few hundred thousand elements.
+     */
+    template <typename Node>
+    void destroy_chain(std::unique_ptr<Node> chain) noexcept {
+        while (chain) chain = std::move(chain->next);
+    }
+
+    /// @brief Returns the last node of a non-empty chain. O(length).
+    template <typename Node>
+    Node *last_node(Node *node) noexcept {
+        while (node->next) node = node->next.get();
+        return node;
+    }
+
+    /**
+     * @brief Stable merge of two sorted chains. Takes from `a` on ties. O(|a| + |b|).
+     * * `less(x, y)` compares two nodes. If it throws, no node is lost: every
+     * node of both chains is left in `a`, in unspecified order, and `b` is empty.
+     */
+    template <typename Node, typename Less>
+    std::unique_ptr<Node> merge_chains(std::unique_ptr<Node> &a, std::unique_ptr<Node> &b, Less &less) {
+        std::unique_ptr<Node> result;
+        std::unique_ptr<Node> *out = &result;
+        try {
+            while (a && b) {
+                std::unique_ptr<Node> &pick = less(*b, *a) ? b : a;
+                *out = std::move(pick);
+                pick = std::move((*out)->next);
+                out = &(*out)->next;
+            }
+        } catch (...) {
+            *out = std::move(a);
+            while (*out) out = &(*out)->next;
+            *out = std::move(b);
+            a = std::move(result);
+            throw;
+        }
+        *out = a ? std::move(a) : std::move(b);
+        return result;
+    }
+
+    /**
+     * @brief Stable bottom-up merge sort of a chain by relinking. O(N log N), no allocation.
+     * * If `less` throws, every node is put back into `head`, in unspecified
+     * order, before the exception propagates.
+     * @return The last node of the sorted chain, or null if it is empty.
+     */
+    template <typename Node, typename Less>
+    Node *sort_chain(std::unique_ptr<Node> &head, Less &less) {
+        std::unique_ptr<Node> bins[64]; // bins[i] holds a sorted run of 2^i nodes
+        try {
+            while (head) {
+                std::unique_ptr<Node> run = std::move(head);
+                head = std::move(run->next);
+                std::size_t i = 0;
+                for (; bins[i]; ++i) run = merge_chains(bins[i], run, less);
+                bins[i] = std::move(run);
+            }
+            for (auto &bin : bins)
+                if (bin) head = merge_chains(bin, head, less);
+        } catch (...) {
+            // A throwing merge leaves its nodes in its first argument: a bin.
+            for (auto &bin : bins) {
+                if (!bin) continue;
+                last_node(bin.get())->next = std::move(head);
+                head = std::move(bin);
+            }
+            throw;
+        }
+        return head ? last_node(head.get()) : nullptr;
+    }
+
+    /**
+     * @brief Base of every list node; routes node allocation to `Layout::node_resource()` when the layout has one.
+     * * The primary template is empty, so nodes use the global operator new.
+     */
+    template <typename Layout, typename = void>
+    struct NodeAllocation
+    {
+    };
+
+    /**
+     * @brief Class-specific operator new/delete drawing nodes from `Layout::node_resource()`.
+     * * The resource needs `allocate(bytes, alignment)` and `deallocate(p, bytes,
+     * alignment)`, e.g. a `std::pmr::memory_resource`. It is looked up per type,
+     * not per list, so it must not change while any list of that type holds nodes.
+     */
+    template <typename Layout>
+    struct NodeAllocation<Layout, std::void_t<decltype(Layout::node_resource())>>
+    {
+        static void *operator new(std::size_t bytes) {
+            return Layout::node_resource()->allocate(bytes, alignof(std::max_align_t));
+        }
+        static void *operator new(std::size_t bytes, std::align_val_t alignment) {
+            return Layout::node_resource()->allocate(bytes, static_cast<std::size_t>(alignment));
+        }
+        static void operator delete(void *p, std::size_t bytes) noexcept {
+            Layout::node_resource()->deallocate(p, bytes, alignof(std::max_align_t));
+        }
+        static void operator delete(void *p, std::size_t bytes, std::align_val_t alignment) noexcept {
+            Layout::node_resource()->deallocate(p, bytes, static_cast<std::size_t>(alignment));
+        }
+    };
+}
+
+/**
+ * @brief Speed/memory trade-off for SinglyLinkedList::reverse_view().
+ */
+enum class ReverseBuffering
+{
+    recompute, // Keep only sqrt(N) checkpoints; reach each element by walking from its checkpoint
+    block      // Also buffer the current block of sqrt(N) node pointers; O(1) per element
+};
 
 /**
  * @brief A modern C++ implementation of a singly linked list container.
@@ -19,8 +172,11 @@
  * management via std::unique_ptr and modern C++ features like move semantics
  * and emplacement.
  * * @tparam T The type of the elements.
+ * @tparam Layout Member and node alignment policy (CompactLayout or CacheAlignedLayout).
+ *   A layout may also provide `static R *node_resource()` to allocate nodes
+ *   from a memory resource instead of the global heap (see NumaLayout).
  */
-template <typename T>
+template <typename T, typename Layout = CompactLayout>
 class SinglyLinkedList
 {
 private:
@@ -29,7 +185,8 @@ private:
      * * Each node contains the element data and a smart pointer to the next node,
      * ensuring automatic memory cleanup.
      */
-    struct Node
+    struct alignas(std::max({Layout::node_alignment, alignof(T), alignof(void *)})) Node
+        : sll_detail::NodeAllocation<Layout>
     {
         T data;
         std::unique_ptr<Node> next;
@@ -45,9 +202,173 @@ private:
             : data(std::forward<Args>(args)...), next(nullptr) {}
     };
 
-    std::unique_ptr<Node> head_; // Smart pointer to the first node
-    Node *tail_;                 // Raw pointer to the last node for O(1) push_back
-    std::size_t list_size;       // Cached size of the list
+    // Never below the natural alignment, so CompactLayout leaves the layout untouched.
+    static constexpr std::size_t member_alignment = std::max(Layout::member_alignment, alignof(void *));
+
+    alignas(member_alignment) std::unique_ptr<Node> head_; // Smart pointer to the first node
+    alignas(member_alignment) Node *tail_;                 // Raw pointer to the last node for O(1) push_back
+    alignas(member_alignment) std::size_t list_size;       // Cached size of the list
+
+    /**
+     * @brief Checkpoint trail behind the opt-in back-poppable pop_back().
+     * * `checkpoints` holds the first node of each segment of `stride` nodes, in
+     * list order. `block` holds the expanded last segment: consecutive nodes that
+     * end at the predecessor of `tail_`. When `block` is empty the last segment
+     * runs from `checkpoints.back()` to the predecessor of `tail_` and is expanded
+     * on the next pop_back(). A rebuild walks the whole list, O(N); every node is
+     * walked at most twice per rebuild, so only a run of pop_back() calls with no
+     * invalidating modifier in between is amortized O(1) each.
+     */
+    struct BackTrail
+    {
+        std::vector<Node *> checkpoints;
+        std::vector<Node *> block;
+        std::size_t stride = 16;
+        bool valid = false;
+    };
+    // Null unless set_back_poppable(true). The one pointer is what every list pays for the opt-in
+    // mode; making it a template parameter would split the list into two incompatible types.
+    std::unique_ptr<BackTrail> back_trail_;
+
+    /// @brief Drops the trail after a modification it cannot follow; rebuilt on the next pop_back().
+    void trail_invalidate() noexcept {
+        if (back_trail_) back_trail_->valid = false;
+    }
+
+    /// @brief Keeps the trail valid across a push_back. `old_tail` is the tail before the push.
+    void trail_push_back(Node *old_tail) noexcept {
+        if (!back_trail_ || !back_trail_->valid || !old_tail) return;
+        try {
+            if (!back_trail_->block.empty()) back_trail_->block.push_back(old_tail);
+            else if (back_trail_->checkpoints.empty()) back_trail_->checkpoints.push_back(old_tail);
+        } catch (...) {
+            back_trail_->valid = false;
+        }
+    }
+
+    /**
+     * @brief Returns the predecessor of `tail_` from the trail and drops it from the block.
+     * * Requires size() >= 2. Returns nullptr if the trail is disabled or cannot allocate.
+     */
+    Node *trail_take_predecessor() noexcept {
+        if (!back_trail_) return nullptr;
+        BackTrail &trail = *back_trail_;
+        try {
+            if (!trail.valid) {
+                trail.checkpoints.clear();
+                trail.block.clear();
+                trail.stride = std::max<std::size_t>(16, static_cast<std::size_t>(std::sqrt(double(list_size))));
+                trail.checkpoints.push_back(head_.get());
+                trail.valid = true;
+            }
+            while (trail.block.empty()) {
+                if (trail.checkpoints.empty()) {
+                    trail.valid = false;
+                    return nullptr;
+                }
+                Node *node = trail.checkpoints.back();
+                trail.checkpoints.pop_back();
+                // Expand the last segment, re-splitting it if push_back made it longer than a stride.
+                for (; node != tail_; node = node->next.get()) {
+                    if (trail.block.size() == trail.stride) {
+                        trail.checkpoints.push_back(trail.block.front());
+                        trail.block.clear();
+                    }
+                    trail.block.push_back(node);
+                }
+            }
+        } catch (...) {
+            trail.valid = false;
+            return nullptr;
+        }
+        Node *predecessor = trail.block.back();
+        trail.block.pop_back();
+        return predecessor;
+    }
+
+    /// @brief Destroys a detached chain front to back without recursing (see sll_detail::destroy_chain).
+    static void destroy_chain(std::unique_ptr<Node> chain) noexcept { sll_detail::destroy_chain(std::move(chain)); }
+
+    /// @brief Keeps the first `n` elements and destroys the rest. Requires n <= size().
+    void truncate(std::size_t n) noexcept {
+        if (n == list_size) return;
+        trail_invalidate();
+        if (n == 0) {
+            clear();
+            return;
+        }
+        Node *last = head_.get();
+        for (std::size_t i = 1; i < n; ++i) last = last->next.get();
+        destroy_chain(std::move(last->next));
+        tail_ = last;
+        list_size = n;
+    }
+
+    /// @brief Detaches the first node and returns ownership of it. The list must not be empty.
+    std::unique_ptr<Node> unlink_front() noexcept {
+        trail_invalidate();
+        std::unique_ptr<Node> old = std::move(head_);
+        head_ = std::move(old->next);
+        if (!head_) tail_ = nullptr;
+        --list_size;
+        return old;
+    }
+
+    /// @brief Detaches the node after `current` and returns ownership of it. That node must exist.
+    std::unique_ptr<Node> unlink_after(Node *current) noexcept {
+        trail_invalidate();
+        std::unique_ptr<Node> old = std::move(current->next);
+        if (tail_ == old.get()) tail_ = current;
+        current->next = std::move(old->next);
+        --list_size;
+        return old;
+    }
+
+    /// @brief A detached run of nodes with its last node and length, for algorithms that split the list.
+    struct Chain
+    {
+        std::unique_ptr<Node> head;
+        Node *tail = nullptr;
+        std::size_t size = 0;
+
+        void push_back(std::unique_ptr<Node> node) noexcept {
+            Node *raw = node.get();
+            if (tail) tail->next = std::move(node);
+            else head = std::move(node);
+            tail = raw;
+            ++size;
+        }
+
+        void append(Chain &&other) noexcept {
+            if (!other.head) return;
+            if (tail) tail->next = std::move(other.head);
+            else head = std::move(other.head);
+            tail = other.tail;
+            size += other.size;
+            other.tail = nullptr;
+            other.size = 0;
+        }
+    };
+
+    /**
+     * @brief Builds `n` nodes from `make()` as a detached chain, then links it after `tail_` once.
+     * * If a construction throws, the partial chain is destroyed and the list is unchanged.
+     */
+    template <typename Make>
+    void append_chain(std::size_t n, Make make) {
+        if (n == 0) return;
+        std::unique_ptr<Node> first = make();
+        Node *last = first.get();
+        for (std::size_t i = 1; i < n; ++i) {
+            last->next = make();
+            last = last->next.get();
+        }
+        trail_invalidate();
+        if (!head_) head_ = std::move(first);
+        else tail_->next = std::move(first);
+        tail_ = last;
+        list_size += n;
+    }
 
 public:
     // Forward declarations for iterator classes
@@ -64,7 +385,7 @@ public:
         Node *ptr_;
         
         // Allow the main list class and const_iterator to access ptr_
-        friend class SinglyLinkedList<T>;
+        friend class SinglyLinkedList;
         friend class const_iterator;
 
     public:
@@ -89,7 +410,7 @@ public:
     class const_iterator
     {
         const Node *ptr_;
-        friend class SinglyLinkedList<T>;
+        friend class SinglyLinkedList;
 
     public:
         using iterator_category = std::forward_iterator_tag;
@@ -118,14 +439,15 @@ public:
     /// @brief Default constructor. Creates an empty list.
     SinglyLinkedList() noexcept : head_(nullptr), tail_(nullptr), list_size(0) {}
     
-    /// @brief Destructor. Cleans up all nodes automatically.
-    ~SinglyLinkedList() = default;
+    /// @brief Destructor. Cleans up all nodes without recursing once per node.
+    ~SinglyLinkedList() { destroy_chain(std::move(head_)); }
     
     /**
      * @brief Copy constructor. Creates a deep copy of another list.
      * @param other The list to copy from.
      */
     SinglyLinkedList(const SinglyLinkedList &other) : SinglyLinkedList() {
+        set_back_poppable(other.back_poppable());
         for (const auto &val : other)
             push_back(val);
     }
@@ -144,7 +466,8 @@ public:
      * @param other The list to move from (will be empty after move).
      */
     SinglyLinkedList(SinglyLinkedList &&other) noexcept 
-        : head_(std::move(other.head_)), tail_(other.tail_), list_size(other.list_size) {
+        : head_(std::move(other.head_)), tail_(other.tail_), list_size(other.list_size),
+          back_trail_(std::move(other.back_trail_)) {
         other.tail_ = nullptr;
         other.list_size = 0;
     }
@@ -169,6 +492,7 @@ public:
         swap(a.head_, b.head_);
         swap(a.tail_, b.tail_);
         swap(a.list_size, b.list_size);
+        swap(a.back_trail_, b.back_trail_);
     }
 
     // --- CAPACITY ---
@@ -179,11 +503,28 @@ public:
     /// @brief Checks if the list is empty. O(1).
     bool empty() const noexcept { return list_size == 0; }
 
+    /**
+     * @brief Enables or disables the back-poppable mode.
+     * * When enabled, the list keeps a trail of about sqrt(N) checkpoint pointers,
+     * refreshed lazily. push_back() keeps the trail valid; other modifiers drop
+     * it, and the next pop_back() rebuilds it by walking the list, O(N). The
+     * pop_back() calls after that cost amortized O(1) each until the trail is
+     * dropped again. Costs one pointer per list even while disabled.
+     */
+    void set_back_poppable(bool enable) {
+        if (enable && !back_trail_) back_trail_ = std::make_unique<BackTrail>();
+        else if (!enable) back_trail_.reset();
+    }
+
+    /// @brief Checks whether the back-poppable mode is enabled. O(1).
+    bool back_poppable() const noexcept { return back_trail_ != nullptr; }
+
     // --- MODIFIERS ---
 
     /// @brief Removes all elements from the list. O(N).
     void clear() noexcept {
-        head_.reset(); // unique_ptr's destructor handles chained deletion
+        trail_invalidate();
+        destroy_chain(std::move(head_));
         tail_ = nullptr;
         list_size = 0;
     }
@@ -194,6 +535,7 @@ public:
      */
     void push_front(const T &value) {
         auto node = std::make_unique<Node>(value);
+        trail_invalidate();
         if (!head_) tail_ = node.get();
         else node->next = std::move(head_);
         head_ = std::move(node);
@@ -206,6 +548,7 @@ public:
      */
     void push_front(T &&value) {
         auto node = std::make_unique<Node>(std::move(value));
+        trail_invalidate();
         if (!head_) tail_ = node.get();
         else node->next = std::move(head_);
         head_ = std::move(node);
@@ -220,6 +563,7 @@ public:
     template <typename... Args>
     void emplace_front(Args&&... args) {
         auto node = std::make_unique<Node>(std::in_place, std::forward<Args>(args)...);
+        trail_invalidate();
         if (!head_) tail_ = node.get();
         else node->next = std::move(head_);
         head_ = std::move(node);
@@ -233,6 +577,7 @@ public:
     void push_back(const T &value) {
         auto node = std::make_unique<Node>(value);
         Node *raw = node.get();
+        trail_push_back(tail_);
         if (!head_) head_ = std::move(node);
         else tail_->next = std::move(node);
         tail_ = raw;
@@ -246,6 +591,7 @@ public:
     void push_back(T &&value) {
         auto node = std::make_unique<Node>(std::move(value));
         Node* raw = node.get();
+        trail_push_back(tail_);
         if (!head_) head_ = std::move(node);
         else tail_->next = std::move(node);
         tail_ = raw;
@@ -261,34 +607,101 @@ public:
     void emplace_back(Args&&... args) {
         auto node = std::make_unique<Node>(std::in_place, std::forward<Args>(args)...);
         Node* raw = node.get();
+        trail_push_back(tail_);
         if (!head_) head_ = std::move(node);
         else tail_->next = std::move(node);
         tail_ = raw;
         ++list_size;
     }
 
+    /**
+     * @brief Appends `n` elements, each constructed in-place from `args`. O(n).
+     * * The new nodes are linked in one pass and `tail_`/`size()` are updated once.
+     * Strong exception guarantee: if a construction throws, the list is unchanged.
+     * @param n Number of elements to append.
+     * @param args Arguments passed (as lvalues) to every element's constructor.
+     */
+    template <typename... Args>
+    void emplace_back_n(std::size_t n, const Args&... args) {
+        append_chain(n, [&] { return std::make_unique<Node>(std::in_place, args...); });
+    }
+
+    /**
+     * @brief Appends `n` elements produced by successive calls to `fn()`. O(n).
+     * * Same batching and exception guarantee as emplace_back_n().
+     * @param n Number of elements to append.
+     * @param fn Generator called once per element, in list order.
+     */
+    template <typename Generator>
+    void generate_back_n(std::size_t n, Generator fn) {
+        append_chain(n, [&] { return std::make_unique<Node>(std::in_place, fn()); });
+    }
+
+    /**
+     * @brief Resizes the list to `n` elements, appending value-initialized elements if it grows.
+     * * Shrinking walks to the new last element and drops the rest in one step.
+     * O(max(size(), n)).
+     */
+    void resize(std::size_t n) {
+        if (n <= list_size) truncate(n);
+        else append_chain(n - list_size, [] { return std::make_unique<Node>(std::in_place); });
+    }
+
+    /// @brief Resizes the list to `n` elements, appending copies of `value` if it grows.
+    void resize(std::size_t n, const T &value) {
+        if (n <= list_size) truncate(n);
+        else append_chain(n - list_size, [&] { return std::make_unique<Node>(value); });
+    }
+
     /// @brief Removes the first element of the list. O(1).
     void pop_front() {
         if (!head_) throw std::out_of_range("pop_front on an empty list");
-        head_ = std::move(head_->next);
-        if (!head_) tail_ = nullptr;
-        --list_size;
+        unlink_front();
     }
 
-    /// @brief Removes the last element of the list. O(N).
+    /**
+     * @brief Removes the first element, deferring its deallocation to a reclaimer. O(1).
+     * * The node is handed to `reclaimer.retire()` instead of being deleted, so
+     * readers that reached it under a reclamation guard can finish with it safely.
+     * @param reclaimer A participant of EpochReclaimer or HazardPointerReclaimer.
+     */
+    template <typename Reclaimer>
+    void pop_front(Reclaimer &reclaimer) {
+        if (!head_) throw std::out_of_range("pop_front on an empty list");
+        reclaimer.retire(unlink_front().release());
+    }
+
+    /**
+     * @brief Removes the last element of the list.
+     * * O(N). In back-poppable mode (see set_back_poppable()) a run of calls is
+     * amortized O(1) each, but the first call after any modifier other than
+     * push_back() rebuilds the trail in O(N).
+     */
     void pop_back() {
         if (!head_) throw std::out_of_range("pop_back on an empty list");
         if (head_.get() == tail_) {
             pop_front();
         } else {
-            Node *current = head_.get();
-            while (current->next.get() != tail_) current = current->next.get();
+            Node *current = trail_take_predecessor();
+            if (!current) {
+                current = head_.get();
+                while (current->next.get() != tail_) current = current->next.get();
+            }
             current->next.reset();
             tail_ = current;
             --list_size;
         }
     }
 
+    /**
+     * @brief Removes the last `n` elements in a single walk. O(N).
+     * @param n Number of elements to remove. Throws std::out_of_range if n > size().
+     */
+    void pop_back_n(std::size_t n) {
+        if (n > list_size) throw std::out_of_range("pop_back_n: n exceeds the list size");
+        truncate(list_size - n);
+    }
+
     /**
      * @brief Inserts an element after the given position. O(1).
      * @param pos An iterator to the element after which to insert.
@@ -298,6 +711,7 @@ public:
     iterator insert_after(const_iterator pos, const T &value) {
         Node *current = const_cast<Node*>(pos.ptr_);
         if (!current) throw std::invalid_argument("Cannot insert_after a null iterator");
+        trail_invalidate();
         auto node = std::make_unique<Node>(value);
         Node *raw = node.get();
         if (tail_ == current) tail_ = raw;
@@ -310,6 +724,7 @@ public:
     iterator insert_after(const_iterator pos, T &&value) {
         Node *current = const_cast<Node*>(pos.ptr_);
         if (!current) throw std::invalid_argument("Cannot insert_after a null iterator");
+        trail_invalidate();
         auto node = std::make_unique<Node>(std::move(value));
         Node *raw = node.get();
         if (tail_ == current) tail_ = raw;
@@ -329,6 +744,7 @@ public:
     iterator emplace_after(const_iterator pos, Args&&... args) {
         Node *current = const_cast<Node*>(pos.ptr_);
         if (!current) throw std::invalid_argument("Cannot emplace_after a null iterator");
+        trail_invalidate();
         auto node = std::make_unique<Node>(std::in_place, std::forward<Args>(args)...);
         Node *raw = node.get();
         if (tail_ == current) tail_ = raw;
@@ -346,17 +762,113 @@ public:
     iterator erase_after(const_iterator pos) {
         Node *current = const_cast<Node*>(pos.ptr_);
         if (!current || !current->next) throw std::out_of_range("Cannot erase_after: no next element");
-        auto to_delete = std::move(current->next);
-        Node *next_node = to_delete->next.get();
-        if (tail_ == to_delete.get()) tail_ = current;
-        current->next = std::move(to_delete->next);
-        --list_size;
-        return iterator(next_node);
+        unlink_after(current);
+        return iterator(current->next.get());
+    }
+
+    /**
+     * @brief Erases the element after the given position, deferring its deallocation. O(1).
+     * @param pos An iterator to the element before the one to erase.
+     * @param reclaimer A participant of EpochReclaimer or HazardPointerReclaimer.
+     * @return An iterator to the element that followed the erased element.
+     */
+    template <typename Reclaimer>
+    iterator erase_after(const_iterator pos, Reclaimer &reclaimer) {
+        Node *current = const_cast<Node*>(pos.ptr_);
+        if (!current || !current->next) throw std::out_of_range("Cannot erase_after: no next element");
+        reclaimer.retire(unlink_after(current).release());
+        return iterator(current->next.get());
+    }
+
+    /**
+     * @brief Inserts `value` into a list sorted by `comp`, after any equal elements.
+     * * O(1) when `value` belongs at either end, O(N) otherwise.
+     * @return An iterator to the new element; pass it as the hint of the next insert.
+     */
+    template <typename Compare = std::less<T>>
+    iterator insert_sorted(T value, Compare comp = Compare()) {
+        if (!head_ || comp(value, head_->data)) {
+            push_front(std::move(value));
+            return begin();
+        }
+        return insert_sorted_from(head_.get(), std::move(value), comp);
+    }
+
+    /**
+     * @brief Inserts `value` into a sorted list, starting the search at the finger `hint`.
+     * * When the input arrives in roughly increasing order, `hint` (typically the
+     * iterator returned by the previous insert) is just before the insertion
+     * point and the insert is close to O(1). If `*hint` is greater than `value`,
+     * or `hint` is end(), the search falls back to the head.
+     * @return An iterator to the new element.
+     */
+    template <typename Compare = std::less<T>>
+    iterator insert_sorted(const_iterator hint, T value, Compare comp = Compare()) {
+        Node *finger = const_cast<Node*>(hint.ptr_);
+        if (!finger || comp(value, finger->data)) return insert_sorted(std::move(value), comp);
+        return insert_sorted_from(finger, std::move(value), comp);
+    }
+
+    /**
+     * @brief Rotates the list left so that the element at index `k % size()` becomes the front.
+     * * Relinks `head_` and `tail_` only: no element is moved, copied or allocated.
+     * Iterators stay valid. O(k % size()); rotate right by k with rotate(size() - k).
+     */
+    void rotate(std::size_t k) noexcept {
+        if (list_size < 2) return;
+        k %= list_size;
+        if (k == 0) return;
+        trail_invalidate();
+        Node *new_tail = head_.get();
+        for (std::size_t i = 1; i < k; ++i) new_tail = new_tail->next.get();
+        std::unique_ptr<Node> new_head = std::move(new_tail->next);
+        tail_->next = std::move(head_);
+        head_ = std::move(new_head);
+        tail_ = new_tail;
+    }
+
+    /**
+     * @brief Moves the elements in the open range (first, last) to just after `pos`.
+     * * The within-list counterpart of forward_list::splice_after: nodes are
+     * relinked, never copied, and iterators stay valid. `pos` must not lie inside
+     * (first, last). O(distance(first, last)) to find the end of the range.
+     */
+    void move_range_after(const_iterator pos, const_iterator first, const_iterator last) {
+        Node *target = const_cast<Node*>(pos.ptr_);
+        Node *before = const_cast<Node*>(first.ptr_);
+        if (!target || !before) throw std::invalid_argument("move_range_after: null iterator");
+        if (target == before || before->next.get() == last.ptr_) return;
+        relink_range_after(target, before, last_in_range(before, last.ptr_));
+    }
+
+    /**
+     * @brief Swaps the open ranges (first1, last1) and (first2, last2) by relinking.
+     * * The ranges must not overlap; they may be adjacent, empty, and in either
+     * order. No element is copied and iterators stay valid.
+     * O(distance(first1, last1) + distance(first2, last2)).
+     */
+    void swap_ranges_after(const_iterator first1, const_iterator last1,
+                           const_iterator first2, const_iterator last2) {
+        Node *before1 = const_cast<Node*>(first1.ptr_);
+        Node *before2 = const_cast<Node*>(first2.ptr_);
+        if (!before1 || !before2) throw std::invalid_argument("swap_ranges_after: null iterator");
+        Node *end1 = last_in_range(before1, last1.ptr_);
+        Node *end2 = last_in_range(before2, last2.ptr_);
+        bool empty1 = end1 == before1, empty2 = end2 == before2;
+        if (empty1 && empty2) return;
+        if (empty1) return relink_range_after(before1, before2, end2);
+        if (empty2) return relink_range_after(before2, before1, end1);
+        if (end1 == before2) return relink_range_after(before1, before2, end2); // Range 2 directly follows range 1
+        if (end2 == before1) return relink_range_after(before2, before1, end1); // Range 1 directly follows range 2
+        // Put range 1 in front of range 2, then move range 2 (now following end1) to range 1's old place.
+        relink_range_after(before2, before1, end1);
+        relink_range_after(before1, end1, end2);
     }
 
     /// @brief Reverses the order of the elements in the list. O(N).
     void reverse() noexcept {
         if (list_size < 2) return;
+        trail_invalidate();
         Node *prev = nullptr;
         std::unique_ptr<Node> current = std::move(head_);
         tail_ = current.get();
@@ -369,6 +881,420 @@ public:
         head_.reset(prev);
     }
 
+    /**
+     * @brief Removes every element equal to an earlier one, keeping first occurrences in order.
+     * * One pass with an open-addressing set of node pointers sized from
+     * `size()`, so no element is copied or hashed twice into storage.
+     * Duplicates are unlinked onto a side chain and freed together at the end.
+     * @return The number of elements removed. O(N) expected.
+     */
+    template <typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+    std::size_t dedupe(Hash hash = Hash(), KeyEqual eq = KeyEqual()) {
+        if (list_size < 2) return 0;
+        std::size_t capacity = 4;
+        while (capacity < 2 * list_size) capacity *= 2; // Load factor at most 1/2
+        std::vector<const Node *> seen(capacity, nullptr);
+        const std::size_t mask = capacity - 1;
+
+        Chain removed;
+        try {
+            Node *prev = nullptr;
+            Node *node = head_.get();
+            while (node) {
+                std::size_t slot = hash(node->data) & mask;
+                while (seen[slot] && !eq(seen[slot]->data, node->data)) slot = (slot + 1) & mask;
+                if (!seen[slot]) {
+                    seen[slot] = node;
+                    prev = node;
+                    node = node->next.get();
+                    continue;
+                }
+                removed.push_back(unlink_after(prev)); // The head is always kept, so prev is set
+                node = prev->next.get();
+            }
+        } catch (...) {
+            destroy_chain(std::move(removed.head));
+            throw;
+        }
+        destroy_chain(std::move(removed.head));
+        return removed.size;
+    }
+
+    /**
+     * @brief Removes every element satisfying `pred` in one pass.
+     * * Matching nodes are unlinked onto a side chain and freed together once
+     * the walk is done, keeping deallocation out of the scan.
+     * @return The number of elements removed. O(N).
+     */
+    template <typename Predicate>
+    std::size_t remove_if(Predicate pred) {
+        Chain removed;
+        try {
+            while (head_ && pred(head_->data)) removed.push_back(unlink_front());
+            for (Node *prev = head_.get(); prev && prev->next;) {
+                if (pred(prev->next->data)) removed.push_back(unlink_after(prev));
+                else prev = prev->next.get();
+            }
+        } catch (...) {
+            destroy_chain(std::move(removed.head));
+            throw;
+        }
+        destroy_chain(std::move(removed.head));
+        return removed.size;
+    }
+
+    // --- MERGING ---
+
+    /**
+     * @brief Merges many lists, each sorted by `comp`, into one sorted list.
+     * * A loser (tournament) tree picks the next node with ceil(log2(k))
+     * comparisons per element, and nodes are spliced into the result, never
+     * copied. The only allocation is the k-entry tree itself. Stable: equal
+     * elements keep their list order, earlier lists first. Every input list is
+     * left empty. O(N log k).
+     */
+    template <typename Compare = std::less<T>>
+    static SinglyLinkedList merge_k(std::vector<SinglyLinkedList> &lists, Compare comp = Compare()) {
+        SinglyLinkedList result;
+        const std::size_t k = lists.size();
+        if (k == 0) return result;
+        if (k == 1) {
+            swap(result, lists[0]);
+            return result;
+        }
+        std::vector<std::size_t> losers(k);
+        // Leaf i sits at tree position k + i; internal node p keeps the loser of its match.
+        std::size_t winner = loser_tree_build(lists, losers, 1, comp);
+        std::unique_ptr<Node> *out = &result.head_;
+        Node *last = nullptr;
+        while (lists[winner].head_) {
+            SinglyLinkedList &source = lists[winner];
+            *out = std::move(source.head_);
+            last = out->get();
+            source.head_ = std::move(last->next);
+            out = &last->next;
+            for (std::size_t p = (winner + k) / 2; p > 0; p /= 2)
+                if (loser_tree_beats(lists, losers[p], winner, comp)) std::swap(losers[p], winner);
+        }
+        for (auto &list : lists) {
+            result.list_size += list.list_size;
+            list.tail_ = nullptr;
+            list.list_size = 0;
+            list.trail_invalidate();
+        }
+        result.tail_ = last;
+        return result;
+    }
+
+    /**
+     * @brief Sorts the list in place. Stable; equal elements keep their order.
+     * * A bottom-up merge sort that relinks nodes: no element is moved or
+     * copied, no memory is allocated, and iterators stay valid. O(N log N).
+     * If `comp` throws, the list keeps every element, in unspecified order.
+     */
+    template <typename Compare = std::less<T>>
+    void sort(Compare comp = Compare()) {
+        if (list_size < 2) return;
+        trail_invalidate();
+        auto less = [&comp](const Node &a, const Node &b) { return comp(a.data, b.data); };
+        try {
+            tail_ = sll_detail::sort_chain(head_, less);
+        } catch (...) {
+            tail_ = sll_detail::last_node(head_.get());
+            throw;
+        }
+    }
+
+    // --- SELECTION ---
+
+    /**
+     * @brief Returns a new list holding copies of the `k` smallest elements, sorted by `comp`.
+     * * One pass keeps the best `k` node pointers in a bounded max-heap, so the
+     * list is not modified and only the winners are copied. Among equal
+     * elements at the cut-off, earlier ones are kept. O(N log k).
+     */
+    template <typename Compare = std::less<T>>
+    SinglyLinkedList top_k(std::size_t k, Compare comp = Compare()) const {
+        SinglyLinkedList result;
+        if (k == 0) return result;
+        std::vector<const Node *> heap;
+        heap.reserve(std::min(k, list_size));
+        auto worse = [&comp](const Node *a, const Node *b) { return comp(a->data, b->data); };
+        for (const Node *node = head_.get(); node; node = node->next.get()) {
+            if (heap.size() < k) {
+                heap.push_back(node);
+                std::push_heap(heap.begin(), heap.end(), worse);
+            } else if (comp(node->data, heap.front()->data)) {
+                std::pop_heap(heap.begin(), heap.end(), worse);
+                heap.back() = node;
+                std::push_heap(heap.begin(), heap.end(), worse);
+            }
+        }
+        std::sort_heap(heap.begin(), heap.end(), worse);
+        result.generate_back_n(heap.size(), [&heap, i = std::size_t(0)]() mutable { return heap[i++]->data; });
+        return result;
+    }
+
+    /**
+     * @brief Partially sorts the list so that the element at index `n` is the one a full sort would put there.
+     * * Every element before it is not greater and every element after it is
+     * not less. Quickselect on the nodes: each round relinks the current range
+     * into less / equal / greater chains around a pseudo-random pivot, then
+     * continues in the chain holding index `n`. No element is moved or copied
+     * and iterators stay valid. Expected O(N).
+     * @return An iterator to the element at index `n`.
+     * @throws std::out_of_range if n >= size().
+     */
+    template <typename Compare = std::less<T>>
+    iterator nth_element(std::size_t n, Compare comp = Compare()) {
+        if (n >= list_size) throw std::out_of_range("nth_element index out of range");
+        trail_invalidate();
+        Chain prefix, suffix, range;
+        range.head = std::move(head_);
+        range.tail = tail_;
+        range.size = list_size;
+        std::uint64_t seed = 0x9E3779B97F4A7C15ull ^ list_size;
+        Node *nth = nullptr;
+        while (!nth) {
+            if (range.size == 1) {
+                nth = range.head.get();
+                break;
+            }
+            seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+            const Node *pivot = range.head.get();
+            for (std::size_t i = seed % range.size; i > 0; --i) pivot = pivot->next.get();
+
+            Chain less, equal, greater;
+            std::unique_ptr<Node> node; // Detached from range while comp runs
+            try {
+                while (range.head) {
+                    node = std::move(range.head);
+                    range.head = std::move(node->next);
+                    if (comp(node->data, pivot->data)) less.push_back(std::move(node));
+                    else if (comp(pivot->data, node->data)) greater.push_back(std::move(node));
+                    else equal.push_back(std::move(node));
+                }
+            } catch (...) {
+                // Put every node back, in some order, before propagating.
+                if (node) equal.push_back(std::move(node));
+                for (Chain *part : {&less, &equal, &greater}) prefix.append(std::move(*part));
+                prefix.append(std::move(range));
+                prefix.append(std::move(suffix));
+                head_ = std::move(prefix.head);
+                tail_ = prefix.tail;
+                throw;
+            }
+
+            if (n < less.size) {
+                equal.append(std::move(greater));
+                equal.append(std::move(suffix));
+                suffix = std::move(equal);
+                range = std::move(less);
+            } else if (n < less.size + equal.size) {
+                nth = equal.head.get();
+                for (std::size_t i = less.size; i < n; ++i) nth = nth->next.get();
+                prefix.append(std::move(less));
+                prefix.append(std::move(equal));
+                greater.append(std::move(suffix));
+                suffix = std::move(greater);
+            } else {
+                n -= less.size + equal.size;
+                prefix.append(std::move(less));
+                prefix.append(std::move(equal));
+                range = std::move(greater);
+            }
+        }
+        prefix.append(std::move(range));
+        prefix.append(std::move(suffix));
+        head_ = std::move(prefix.head);
+        tail_ = prefix.tail;
+        return iterator(nth);
+    }
+
+    // --- CURSOR ---
+
+    /**
+     * @brief An editing position that remembers the node before it.
+     * * Lets a single pass erase, insert and replace elements without tracking a
+     * `prev` iterator by hand and without special-casing the head. The cursor
+     * stores only the predecessor, so edits through the cursor never leave it
+     * dangling. Edits made to the list through other means invalidate it.
+     */
+    class cursor
+    {
+        SinglyLinkedList *list_;
+        Node *prev_; // Node before the current one; nullptr when at the head
+
+        Node *current() const noexcept { return prev_ ? prev_->next.get() : list_->head_.get(); }
+
+    public:
+        explicit cursor(SinglyLinkedList &list) noexcept : list_(&list), prev_(nullptr) {}
+
+        /// @brief Checks whether the cursor is past the last element.
+        bool at_end() const noexcept { return current() == nullptr; }
+
+        /// @brief Accesses the current element. The cursor must not be at the end.
+        T &operator*() const { return current()->data; }
+        T *operator->() const { return &current()->data; }
+
+        /// @brief Returns an iterator to the current element (end() when at the end).
+        iterator position() const noexcept { return iterator(current()); }
+
+        /// @brief Moves to the next element. O(1).
+        void advance() {
+            Node *node = current();
+            if (!node) throw std::out_of_range("cursor::advance past the end");
+            prev_ = node;
+        }
+
+        /// @brief Erases the current element; the cursor moves to the one that followed it. O(1).
+        void erase() {
+            if (at_end()) throw std::out_of_range("cursor::erase at the end");
+            if (prev_) list_->erase_after(const_iterator(prev_));
+            else list_->pop_front();
+        }
+
+        /**
+         * @brief Inserts `value` before the current element; the cursor stays on the current element. O(1).
+         * * At the end this appends to the list.
+         */
+        iterator insert_before(T value) {
+            if (!prev_) {
+                list_->push_front(std::move(value));
+                prev_ = list_->head_.get();
+            } else {
+                prev_ = list_->insert_after(const_iterator(prev_), std::move(value)).ptr_;
+            }
+            return iterator(prev_);
+        }
+
+        /// @brief Inserts `value` after the current element; the cursor does not move. O(1).
+        iterator insert_after(T value) {
+            Node *node = current();
+            if (!node) throw std::out_of_range("cursor::insert_after at the end");
+            return list_->insert_after(const_iterator(node), std::move(value));
+        }
+
+        /// @brief Replaces the current element with `value`. O(1).
+        T &replace(T value) {
+            Node *node = current();
+            if (!node) throw std::out_of_range("cursor::replace at the end");
+            node->data = std::move(value);
+            return node->data;
+        }
+    };
+
+    /// @brief Returns a cursor positioned at the first element.
+    cursor cursor_begin() noexcept { return cursor(*this); }
+
+    // --- REVERSE TRAVERSAL ---
+
+    /**
+     * @brief A read-only, back-to-front view of a list using O(sqrt N) extra memory.
+     * * Construction walks the list once and records a checkpoint every
+     * ceil(sqrt N) nodes. Blocks are then visited from last to first. With
+     * ReverseBuffering::recompute each element is reached by walking from its
+     * block's checkpoint (O(N sqrt N) in total); with ReverseBuffering::block the
+     * block's node pointers are buffered first (O(N) in total). The list must not
+     * be modified while the view is in use. Iterators are single-pass.
+     */
+    class reverse_view_type
+    {
+        std::vector<const Node *> checkpoints_;
+        std::vector<const Node *> buffer_; // Node pointers of the current block (block mode only)
+        std::size_t stride_ = 1;
+        std::size_t size_ = 0;
+        ReverseBuffering mode_;
+
+        std::size_t block_length(std::size_t block) const noexcept {
+            return std::min(stride_, size_ - block * stride_);
+        }
+
+        void load_block(std::size_t block) {
+            buffer_.clear();
+            const Node *node = checkpoints_[block];
+            for (std::size_t i = block_length(block); i > 0; --i, node = node->next.get()) buffer_.push_back(node);
+        }
+
+        const Node *node_at(std::size_t block, std::size_t offset) const noexcept {
+            if (mode_ == ReverseBuffering::block) return buffer_[offset];
+            const Node *node = checkpoints_[block];
+            while (offset--) node = node->next.get();
+            return node;
+        }
+
+    public:
+        reverse_view_type(const SinglyLinkedList &list, ReverseBuffering mode) : size_(list.size()), mode_(mode) {
+            if (size_ == 0) return;
+            stride_ = static_cast<std::size_t>(std::ceil(std::sqrt(double(size_))));
+            checkpoints_.reserve(size_ / stride_ + 1);
+            std::size_t i = 0;
+            for (const Node *node = list.head_.get(); node; node = node->next.get(), ++i)
+                if (i % stride_ == 0) checkpoints_.push_back(node);
+            if (mode_ == ReverseBuffering::block) buffer_.reserve(stride_);
+        }
+
+        /**
+         * @brief Single-pass iterator yielding elements from back to front.
+         */
+        class iterator
+        {
+            reverse_view_type *view_;
+            std::size_t block_;  // Current block; equals checkpoints_.size() at the end
+            std::size_t offset_; // Position inside the block
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            iterator(reverse_view_type *view, std::size_t block, std::size_t offset)
+                : view_(view), block_(block), offset_(offset) {}
+
+            reference operator*() const { return view_->node_at(block_, offset_)->data; }
+            pointer operator->() const { return &**this; }
+
+            iterator &operator++() {
+                if (offset_ > 0) {
+                    --offset_;
+                } else if (block_ == 0) {
+                    block_ = view_->checkpoints_.size();
+                } else {
+                    --block_;
+                    offset_ = view_->block_length(block_) - 1;
+                    if (view_->mode_ == ReverseBuffering::block) view_->load_block(block_);
+                }
+                return *this;
+            }
+
+            bool operator==(const iterator &other) const { return block_ == other.block_ && offset_ == other.offset_; }
+            bool operator!=(const iterator &other) const { return !(*this == other); }
+        };
+
+        /// @brief Starts at the last element. Calling begin() again restarts the traversal.
+        iterator begin() {
+            if (checkpoints_.empty()) return end();
+            std::size_t last = checkpoints_.size() - 1;
+            if (mode_ == ReverseBuffering::block) load_block(last);
+            return iterator(this, last, block_length(last) - 1);
+        }
+
+        iterator end() { return iterator(this, checkpoints_.size(), 0); }
+
+        /// @brief Number of elements the view visits.
+        std::size_t size() const noexcept { return size_; }
+    };
+
+    /**
+     * @brief Returns a view that visits the elements from back to front without modifying the list.
+     * @param mode ReverseBuffering::recompute (least memory) or ReverseBuffering::block (fastest).
+     */
+    reverse_view_type reverse_view(ReverseBuffering mode = ReverseBuffering::recompute) const {
+        return reverse_view_type(*this, mode);
+    }
+
     // --- ELEMENT ACCESS ---
 
     /// @brief Accesses the first element. Throws if the list is empty. O(1).
@@ -410,35 +1336,137 @@ public:
     const_iterator end() const { return const_iterator(nullptr); }
     /// @brief Returns a const_iterator to the end of the list.
     const_iterator cend() const { return const_iterator(nullptr); }
+
+    // --- LOOKUP ---
+
+    /// @brief Returns an iterator to the first element equal to `value`, or end(). O(N).
+    iterator find(const T &value) {
+        Node *node = head_.get();
+        while (node && !(node->data == value)) node = node->next.get();
+        return iterator(node);
+    }
+
+    /// @brief Returns a const_iterator to the first element equal to `value`, or end(). O(N).
+    const_iterator find(const T &value) const {
+        const Node *node = head_.get();
+        while (node && !(node->data == value)) node = node->next.get();
+        return const_iterator(node);
+    }
+
+    /// @brief Checks whether any element equals `value`. O(N).
+    bool contains(const T &value) const { return find(value) != end(); }
+
+    // --- RECLAMATION ---
+
+    /**
+     * @brief Publishes the first node to a reclamation guard and returns an iterator to it.
+     * * The guard protects the same node pointer that `pop_front(reclaimer)` and
+     * `erase_after(pos, reclaimer)` retire, so the element stays valid after the
+     * caller releases whatever lock serializes it with writers. The list itself
+     * is not thread-safe: the call must not race with a modifier.
+     * @param guard An EpochReclaimer::guard or HazardPointerReclaimer::guard.
+     * @return An iterator to the protected element, or end() if the list is empty.
+     */
+    template <typename Guard>
+    const_iterator protect_front(Guard &guard) const noexcept {
+        guard.publish(head_.get());
+        return const_iterator(head_.get());
+    }
+
+    /**
+     * @brief Publishes the node after `pos` to a reclamation guard. See protect_front().
+     * @return An iterator to the protected element, or end() if `pos` is the last element.
+     */
+    template <typename Guard>
+    const_iterator protect_next(Guard &guard, const_iterator pos) const noexcept {
+        const Node *next = pos.ptr_ ? pos.ptr_->next.get() : nullptr;
+        guard.publish(next);
+        return const_iterator(next);
+    }
+
+private:
+    // --- INTERNAL HELPERS (need the iterator types) ---
+
+    /// @brief Returns the last node of the open range (first, last), or `first` if the range is empty.
+    static Node *last_in_range(Node *first, const Node *last) noexcept {
+        Node *node = first;
+        while (node->next.get() != last) node = node->next.get();
+        return node;
+    }
+
+    /// @brief Moves the non-empty chain (before, end] so that it follows `pos`. `pos` must be outside it.
+    void relink_range_after(Node *pos, Node *before, Node *end) noexcept {
+        trail_invalidate();
+        std::unique_ptr<Node> range = std::move(before->next);
+        before->next = std::move(end->next);
+        if (tail_ == end) tail_ = before;
+        end->next = std::move(pos->next);
+        pos->next = std::move(range);
+        if (tail_ == pos) tail_ = end;
+    }
+
+    /// @brief True if the head of list `a` should be taken before the head of list `b`. One comparison.
+    template <typename Compare>
+    static bool loser_tree_beats(const std::vector<SinglyLinkedList> &lists, std::size_t a, std::size_t b, Compare &comp) {
+        const Node *x = lists[a].head_.get(), *y = lists[b].head_.get();
+        if (!y) return true;
+        if (!x) return false;
+        return a < b ? !comp(y->data, x->data) : comp(x->data, y->data); // Ties go to the earlier list
+    }
+
+    /// @brief Plays the matches below tree position `p`, records each loser and returns the winner.
+    template <typename Compare>
+    static std::size_t loser_tree_build(const std::vector<SinglyLinkedList> &lists, std::vector<std::size_t> &losers,
+                                        std::size_t p, Compare &comp) {
+        const std::size_t k = lists.size();
+        if (p >= k) return p - k;
+        std::size_t left = loser_tree_build(lists, losers, 2 * p, comp);
+        std::size_t right = loser_tree_build(lists, losers, 2 * p + 1, comp);
+        bool left_wins = loser_tree_beats(lists, left, right, comp);
+        losers[p] = left_wins ? right : left;
+        return left_wins ? left : right;
+    }
+
+    /// @brief Inserts after the last node, from `start` on, that is not greater than `value`.
+    template <typename Compare>
+    iterator insert_sorted_from(Node *start, T &&value, Compare &comp) {
+        if (!comp(value, tail_->data)) {
+            push_back(std::move(value));
+            return iterator(tail_);
+        }
+        Node *current = start;
+        while (current->next && !comp(value, current->next->data)) current = current->next.get();
+        return insert_after(const_iterator(current), std::move(value));
+    }
 };
 
 // --- NON-MEMBER FUNCTIONS ---
 
 /// @brief Checks if two lists are equal.
-template <typename T>
-bool operator==(const SinglyLinkedList<T> &lhs, const SinglyLinkedList<T> &rhs) {
+template <typename T, typename Layout>
+bool operator==(const SinglyLinkedList<T, Layout> &lhs, const SinglyLinkedList<T, Layout> &rhs) {
     if (lhs.size() != rhs.size()) return false;
     return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
 /// @brief Checks if two lists are not equal.
-template <typename T>
-bool operator!=(const SinglyLinkedList<T> &lhs, const SinglyLinkedList<T> &rhs) {
+template <typename T, typename Layout>
+bool operator!=(const SinglyLinkedList<T, Layout> &lhs, const SinglyLinkedList<T, Layout> &rhs) {
     return !(lhs == rhs);
 }
 
 /// @brief Lexicographically compares two lists.
-template <typename T>
-bool operator<(const SinglyLinkedList<T> &lhs, const SinglyLinkedList<T> &rhs) {
+template <typename T, typename Layout>
+bool operator<(const SinglyLinkedList<T, Layout> &lhs, const SinglyLinkedList<T, Layout> &rhs) {
     return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
 }
 
-template <typename T>
-bool operator<=(const SinglyLinkedList<T> &lhs, const SinglyLinkedList<T> &rhs) { return !(rhs < lhs); }
-template <typename T>
-bool operator>(const SinglyLinkedList<T> &lhs, const SinglyLinkedList<T> &rhs) { return rhs < lhs; }
-template <typename T>
-bool operator>=(const SinglyLinkedList<T> &lhs, const SinglyLinkedList<T> &rhs) { return !(lhs < rhs); }
+template <typename T, typename Layout>
+bool operator<=(const SinglyLinkedList<T, Layout> &lhs, const SinglyLinkedList<T, Layout> &rhs) { return !(rhs < lhs); }
+template <typename T, typename Layout>
+bool operator>(const SinglyLinkedList<T, Layout> &lhs, const SinglyLinkedList<T, Layout> &rhs) { return rhs < lhs; }
+template <typename T, typename Layout>
+bool operator>=(const SinglyLinkedList<T, Layout> &lhs, const SinglyLinkedList<T, Layout> &rhs) { return !(lhs < rhs); }
 
 
 #endif // SINGLY_LINKED_LIST_H
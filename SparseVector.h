@@ -0,0 +1,189 @@
+#ifndef SPARSE_VECTOR_H
+#define SPARSE_VECTOR_H
+
+// Required C++17
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint32_t
+#include <iterator>     // For std::next
+#include <type_traits>  // For std::decay_t, std::common_type_t
+#include <utility>      // For std::pair
+#include <vector>       // For std::vector
+
+#include "SinglyLinkedList.h"
+
+/**
+ * @brief A sparse vector: (index, value) pairs in a singly linked list, sorted by strictly increasing index.
+ * * The kernels below assume that order and keep it. Each one is a single
+ * merge walk over both operands, O(nnz(x) + nnz(y)). While a walk handles
+ * the current pair, it prefetches the next node of each list; the two
+ * chains are independent, so their cache misses overlap instead of queuing.
+ */
+template <typename Index = std::uint32_t, typename Value = float, typename Layout = CompactLayout>
+using SparseVector = SinglyLinkedList<std::pair<Index, Value>, Layout>;
+
+namespace sparse_detail
+{
+    /// @brief Hints the cache to fetch the element after `it`, if there is one.
+    template <typename It>
+    inline void prefetch_next(It it, It end) noexcept {
+#if defined(__GNUC__)
+        It next = std::next(it);
+        if (next != end) __builtin_prefetch(&*next);
+#else
+        (void)it;
+        (void)end;
+#endif
+    }
+}
+
+/**
+ * @brief Returns the dot product of two sparse vectors. O(nnz(x) + nnz(y)).
+ */
+template <typename Index, typename Value, typename Layout>
+Value sparse_dot(const SparseVector<Index, Value, Layout> &x, const SparseVector<Index, Value, Layout> &y) {
+    Value sum = Value();
+    auto xi = x.begin(), yi = y.begin();
+    const auto xe = x.end(), ye = y.end();
+    while (xi != xe && yi != ye) {
+        sparse_detail::prefetch_next(xi, xe);
+        sparse_detail::prefetch_next(yi, ye);
+        if (xi->first < yi->first) {
+            ++xi;
+        } else if (yi->first < xi->first) {
+            ++yi;
+        } else {
+            sum += xi->second * yi->second;
+            ++xi;
+            ++yi;
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Computes `y += alpha * x` in place. O(nnz(x) + nnz(y)).
+ * * Entries of `y` are updated in their own nodes; only indices present in
+ * `x` but not in `y` allocate. Entries that cancel to zero are kept.
+ * `Value` is deduced from the vectors only, so `alpha` may be any
+ * convertible scalar, e.g. `2.0` with float vectors.
+ */
+template <typename Index, typename Value, typename Layout>
+void sparse_axpy(std::common_type_t<Value> alpha, const SparseVector<Index, Value, Layout> &x,
+                 SparseVector<Index, Value, Layout> &y) {
+    auto prev = y.end(); // end() stands for "before the front"
+    auto yi = y.begin();
+    const auto ye = y.end();
+    for (auto xi = x.begin(), xe = x.end(); xi != xe; ++xi) {
+        sparse_detail::prefetch_next(xi, xe);
+        while (yi != ye && yi->first < xi->first) {
+            sparse_detail::prefetch_next(yi, ye);
+            prev = yi++;
+        }
+        if (yi != ye && yi->first == xi->first) {
+            yi->second += alpha * xi->second;
+            prev = yi++;
+        } else if (prev == ye) {
+            y.emplace_front(xi->first, alpha * xi->second);
+            prev = y.begin();
+        } else {
+            prev = y.emplace_after(prev, xi->first, alpha * xi->second);
+        }
+    }
+}
+
+/**
+ * @brief Computes `y += x` element-wise in place. O(nnz(x) + nnz(y)).
+ */
+template <typename Index, typename Value, typename Layout>
+void sparse_add(SparseVector<Index, Value, Layout> &y, const SparseVector<Index, Value, Layout> &x) {
+    sparse_axpy(Value(1), x, y);
+}
+
+/**
+ * @brief Computes `y *= x` element-wise in place. O(nnz(x) + nnz(y)).
+ * * Entries of `y` whose index is absent from `x` become structural zeros
+ * and are erased; the rest are updated in their own nodes. Never allocates.
+ */
+template <typename Index, typename Value, typename Layout>
+void sparse_multiply(SparseVector<Index, Value, Layout> &y, const SparseVector<Index, Value, Layout> &x) {
+    auto prev = y.end();
+    auto yi = y.begin();
+    const auto ye = y.end();
+    auto xi = x.begin();
+    const auto xe = x.end();
+    while (yi != ye) {
+        sparse_detail::prefetch_next(yi, ye);
+        while (xi != xe && xi->first < yi->first) {
+            sparse_detail::prefetch_next(xi, xe);
+            ++xi;
+        }
+        if (xi != xe && xi->first == yi->first) {
+            yi->second *= xi->second;
+            prev = yi++;
+        } else if (prev == ye) {
+            y.pop_front();
+            yi = y.begin();
+        } else {
+            yi = y.erase_after(prev);
+        }
+    }
+}
+
+/**
+ * @brief Many sparse vectors packed into three contiguous arrays (compressed sparse rows).
+ * * Row `r` occupies positions `row_offsets[r]` to `row_offsets[r + 1]` of
+ * `indices` and `values`. The flat arrays suit batched evaluation: the loop
+ * in `multiply` has no pointer chasing and compilers can vectorize it.
+ */
+template <typename Index = std::uint32_t, typename Value = float>
+struct SparseBlock
+{
+    std::vector<std::size_t> row_offsets{0};
+    std::vector<Index> indices;
+    std::vector<Value> values;
+
+    std::size_t rows() const noexcept { return row_offsets.size() - 1; }
+    std::size_t nonzeros() const noexcept { return values.size(); }
+
+    /// @brief Appends a sparse vector as the next row. O(nnz).
+    template <typename Layout>
+    void append_row(const SparseVector<Index, Value, Layout> &row) {
+        indices.reserve(indices.size() + row.size());
+        values.reserve(values.size() + row.size());
+        for (const auto &[index, value] : row) {
+            indices.push_back(index);
+            values.push_back(value);
+        }
+        row_offsets.push_back(values.size());
+    }
+
+    /**
+     * @brief Evaluates every row against a dense vector: `out[r] = row r . dense`. O(nonzeros).
+     * @param dense Must have an entry for every index in the block.
+     * @param out Must have room for `rows()` values.
+     */
+    void multiply(const Value *dense, Value *out) const noexcept {
+        const Index *idx = indices.data();
+        const Value *val = values.data();
+        for (std::size_t r = 0; r < rows(); ++r) {
+            Value sum = Value();
+            for (std::size_t k = row_offsets[r]; k < row_offsets[r + 1]; ++k) sum += val[k] * dense[idx[k]];
+            out[r] = sum;
+        }
+    }
+};
+
+/**
+ * @brief Packs a range of sparse vectors into one SparseBlock, one row each. O(total nnz).
+ */
+template <typename InputIt>
+auto to_csr(InputIt first, InputIt last) {
+    using Pair = std::decay_t<decltype(*first->begin())>;
+    SparseBlock<typename Pair::first_type, typename Pair::second_type> block;
+    for (; first != last; ++first) block.append_row(*first);
+    return block;
+}
+
+#endif // SPARSE_VECTOR_H
@@ -0,0 +1,258 @@
+#ifndef SPLIT_SINGLY_LINKED_LIST_H
+#define SPLIT_SINGLY_LINKED_LIST_H
+
+// Required C++17 for std::invoke_result_t, std::in_place
+// Compile with: g++ -std=c++17 <your_main_file>.cpp
+
+#include <memory>       // For std::unique_ptr, std::make_unique
+#include <stdexcept>    // For std::out_of_range
+#include <cstddef>      // For std::size_t, std::ptrdiff_t
+#include <iterator>     // For iterator tags
+#include <utility>      // For std::move, std::forward
+#include <type_traits>  // For std::invoke_result_t, std::decay_t
+#include <functional>   // For std::invoke, std::less
+
+#include "SinglyLinkedList.h" // For the shared chain algorithms in sll_detail
+
+/**
+ * @brief A singly linked list that keeps a small hot key next to each link.
+ * * Each node stores the key extracted by `Projection` and the `next` pointer;
+ * the element itself lives out of line. Key-only operations (`find_if`,
+ * `sort`, `merge`) walk just the compact hot nodes and never pull the large
+ * payload into the cache. Elements are read-only through iterators so the
+ * cached key cannot go stale; use `modify()` to change an element.
+ * * @tparam T The type of the elements (typically large).
+ * @tparam Projection Callable mapping `const T&` to the key, e.g. a lambda returning `t.id`.
+ */
+template <typename T, typename Projection>
+class SplitSinglyLinkedList
+{
+public:
+    using key_type = std::decay_t<std::invoke_result_t<Projection &, const T &>>;
+
+private:
+    /**
+     * @brief Hot node: key and link side by side, payload behind a pointer.
+     */
+    struct Node
+    {
+        key_type key;
+        std::unique_ptr<Node> next;
+        std::unique_ptr<T> payload; // Cold data, touched only when the element is read
+
+        Node(key_type k, std::unique_ptr<T> p) : key(std::move(k)), next(nullptr), payload(std::move(p)) {}
+    };
+
+    std::unique_ptr<Node> head_; // Smart pointer to the first node
+    Node *tail_;                 // Raw pointer to the last node for O(1) push_back
+    std::size_t list_size;       // Cached size of the list
+    Projection project_;         // Extracts the hot key from an element
+
+    std::unique_ptr<Node> make_node(std::unique_ptr<T> payload) {
+        key_type key = std::invoke(project_, static_cast<const T &>(*payload));
+        return std::make_unique<Node>(std::move(key), std::move(payload));
+    }
+
+    void link_back(std::unique_ptr<Node> node) noexcept {
+        Node *raw = node.get();
+        if (!head_) head_ = std::move(node);
+        else tail_->next = std::move(node);
+        tail_ = raw;
+        ++list_size;
+    }
+
+    void link_front(std::unique_ptr<Node> node) noexcept {
+        if (!head_) tail_ = node.get();
+        else node->next = std::move(head_);
+        head_ = std::move(node);
+        ++list_size;
+    }
+
+    void reset_tail() noexcept {
+        tail_ = head_.get();
+        if (tail_) while (tail_->next) tail_ = tail_->next.get();
+    }
+
+public:
+    /**
+     * @brief A forward iterator giving read-only access to elements and their keys.
+     */
+    class const_iterator
+    {
+        const Node *ptr_;
+        friend class SplitSinglyLinkedList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = const T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        explicit const_iterator(const Node *p = nullptr) : ptr_(p) {}
+
+        reference operator*() const { return *ptr_->payload; }
+        pointer operator->() const { return ptr_->payload.get(); }
+        /// @brief Returns the cached hot key without touching the payload.
+        const key_type &key() const { return ptr_->key; }
+        const_iterator &operator++() { ptr_ = ptr_->next.get(); return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++(*this); return tmp; }
+
+        bool operator==(const const_iterator &other) const { return ptr_ == other.ptr_; }
+        bool operator!=(const const_iterator &other) const { return ptr_ != other.ptr_; }
+    };
+
+    using iterator = const_iterator;
+
+    // --- LIFECYCLE ---
+
+    /// @brief Creates an empty list using the given key projection.
+    explicit SplitSinglyLinkedList(Projection project = Projection())
+        : head_(nullptr), tail_(nullptr), list_size(0), project_(std::move(project)) {}
+
+    /// @brief Destructor. Frees the nodes front to back rather than recursing once per node.
+    ~SplitSinglyLinkedList() { clear(); }
+
+    /// @brief Copy constructor. Deep-copies every payload.
+    SplitSinglyLinkedList(const SplitSinglyLinkedList &other) : SplitSinglyLinkedList(other.project_) {
+        for (const auto &value : other) push_back(value);
+    }
+
+    SplitSinglyLinkedList(SplitSinglyLinkedList &&other) noexcept
+        : head_(std::move(other.head_)), tail_(other.tail_), list_size(other.list_size),
+          project_(std::move(other.project_)) {
+        other.tail_ = nullptr;
+        other.list_size = 0;
+    }
+
+    /// @brief Copy/move assignment (copy-and-swap idiom).
+    SplitSinglyLinkedList &operator=(SplitSinglyLinkedList other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    friend void swap(SplitSinglyLinkedList &a, SplitSinglyLinkedList &b) noexcept {
+        using std::swap;
+        swap(a.head_, b.head_);
+        swap(a.tail_, b.tail_);
+        swap(a.list_size, b.list_size);
+        swap(a.project_, b.project_);
+    }
+
+    // --- CAPACITY ---
+
+    std::size_t size() const noexcept { return list_size; }
+    bool empty() const noexcept { return list_size == 0; }
+
+    // --- MODIFIERS ---
+
+    void clear() noexcept {
+        sll_detail::destroy_chain(std::move(head_));
+        tail_ = nullptr;
+        list_size = 0;
+    }
+
+    void push_front(const T &value) { link_front(make_node(std::make_unique<T>(value))); }
+    void push_front(T &&value) { link_front(make_node(std::make_unique<T>(std::move(value)))); }
+    void push_back(const T &value) { link_back(make_node(std::make_unique<T>(value))); }
+    void push_back(T &&value) { link_back(make_node(std::make_unique<T>(std::move(value)))); }
+
+    /// @brief Constructs an element in-place at the end of the list. O(1).
+    template <typename... Args>
+    void emplace_back(Args &&...args) {
+        link_back(make_node(std::make_unique<T>(std::forward<Args>(args)...)));
+    }
+
+    /// @brief Removes the first element of the list. O(1).
+    void pop_front() {
+        if (!head_) throw std::out_of_range("pop_front on an empty list");
+        head_ = std::move(head_->next);
+        if (!head_) tail_ = nullptr;
+        --list_size;
+    }
+
+    /**
+     * @brief Applies `fn` to the element at `pos` and refreshes its cached key. O(1).
+     * @param fn Callable taking `T&`.
+     */
+    template <typename Fn>
+    void modify(const_iterator pos, Fn fn) {
+        Node *node = const_cast<Node *>(pos.ptr_);
+        if (!node) throw std::out_of_range("Cannot modify the end iterator");
+        fn(*node->payload);
+        node->key = std::invoke(project_, static_cast<const T &>(*node->payload));
+    }
+
+    // --- KEY-ONLY ALGORITHMS ---
+
+    /**
+     * @brief Returns the first element whose key satisfies `pred`. O(N), hot data only.
+     * @param pred Callable taking `const key_type&`.
+     */
+    template <typename KeyPredicate>
+    const_iterator find_if(KeyPredicate pred) const {
+        for (const Node *n = head_.get(); n; n = n->next.get())
+            if (pred(n->key)) return const_iterator(n);
+        return end();
+    }
+
+    /**
+     * @brief Stable sort by key. Relinks nodes; no payload is moved or read. O(N log N).
+     * If `comp` throws, the list keeps every element, in unspecified order.
+     * @param comp Strict weak ordering on keys.
+     */
+    template <typename Compare = std::less<key_type>>
+    void sort(Compare comp = Compare()) {
+        if (list_size < 2) return;
+        auto less = [&comp](const Node &a, const Node &b) { return comp(a.key, b.key); };
+        try {
+            tail_ = sll_detail::sort_chain(head_, less);
+        } catch (...) {
+            reset_tail();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Merges another list sorted by the same key into this sorted list. O(N + M).
+     * * Nodes are spliced, not copied; `other` is left empty. Stable: on equal keys
+     * elements of `*this` come first. If `comp` throws, every element of both
+     * lists ends up in `*this`, in unspecified order.
+     */
+    template <typename Compare = std::less<key_type>>
+    void merge(SplitSinglyLinkedList &other, Compare comp = Compare()) {
+        if (&other == this || !other.head_) return;
+        auto less = [&comp](const Node &a, const Node &b) { return comp(a.key, b.key); };
+        list_size += other.list_size;
+        other.tail_ = nullptr;
+        other.list_size = 0;
+        try {
+            head_ = sll_detail::merge_chains(head_, other.head_, less);
+        } catch (...) {
+            reset_tail();
+            throw;
+        }
+        reset_tail();
+    }
+
+    // --- ELEMENT ACCESS ---
+
+    const T &front() const {
+        if (!head_) throw std::out_of_range("Accessing front() on an empty list");
+        return *head_->payload;
+    }
+
+    const T &back() const {
+        if (!tail_) throw std::out_of_range("Accessing back() on an empty list");
+        return *tail_->payload;
+    }
+
+    // --- ITERATORS ---
+
+    const_iterator begin() const { return const_iterator(head_.get()); }
+    const_iterator cbegin() const { return const_iterator(head_.get()); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+};
+
+#endif // SPLIT_SINGLY_LINKED_LIST_H
@@ -0,0 +1,528 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+
+// Include the header files for the linked list library
+#include "SinglyLinkedList.h"
+#include "MemoryReclamation.h"
+#include "SplitSinglyLinkedList.h"
+#include "CircularSinglyLinkedList.h"
+#include "PairingHeap.h"
+#include "RadixHeap.h"
+
+// Compile with: g++ -std=c++17 -O2 -pthread bench.cpp -o bench
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Runs `body(thread_index)` on `threads` threads and returns the wall time in
+ * nanoseconds. Timing starts once every thread has been created and reached the
+ * start barrier, so thread startup is not counted.
+ */
+template <typename Body>
+double timeThreads(int threads, Body body) {
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            body(t);
+        });
+    }
+    while (ready.load() != threads) std::this_thread::yield();
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto &w : workers) w.join();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+void printRow(const std::string& name, int threads, double ns_per_op) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::setw(8) << threads
+              << std::setw(14) << std::fixed << std::setprecision(1) << ns_per_op << std::endl;
+}
+
+/**
+ * One writer pops from and refills a shared list while `threads - 1` readers
+ * protect its front node, drop the lock and read the element. Reports the
+ * writer's cost per pop, which includes retiring and batched freeing under
+ * reader contention on the epoch or the hazard slots.
+ */
+template <typename Domain>
+double sharedListRun(int threads, int ops) {
+    Domain domain(threads);
+    SinglyLinkedList<long> list;
+    for (long i = 0; i < 64; ++i) list.push_back(i);
+    std::mutex lock;
+    std::atomic<bool> done(false);
+    double writer_ns = 0;
+
+    timeThreads(threads, [&](int t) {
+        typename Domain::participant self(domain);
+        if (t == 0) {
+            auto start = Clock::now();
+            for (int i = 0; i < ops; ++i) {
+                std::lock_guard<std::mutex> hold(lock);
+                list.pop_front(self);
+                list.push_back(i);
+            }
+            writer_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            done.store(true, std::memory_order_release);
+            return;
+        }
+        volatile long sink = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            typename Domain::guard g(self);
+            SinglyLinkedList<long>::const_iterator it;
+            {
+                std::lock_guard<std::mutex> hold(lock);
+                it = list.protect_front(g);
+            }
+            sink = sink + *it; // Read outside the lock; the node may already be retired
+        }
+    });
+    return writer_ns / ops;
+}
+
+void benchReclamation() {
+    std::cout << "\n========== RECLAMATION OVERHEAD (ns per pop_front) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "scheme" << std::right << std::setw(8) << "threads"
+              << std::setw(14) << "ns/op" << std::endl;
+
+    const int ops = 200000;
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        double immediate = timeThreads(threads, [&](int) {
+            SinglyLinkedList<int> list;
+            for (int i = 0; i < ops; ++i) {
+                list.push_back(i);
+                list.pop_front();
+            }
+        });
+        printRow("private: delete", threads, immediate / (double(ops) * threads));
+
+        EpochReclaimer epochs(threads);
+        double epoch = timeThreads(threads, [&](int) {
+            EpochReclaimer::participant self(epochs);
+            SinglyLinkedList<int> list;
+            for (int i = 0; i < ops; ++i) {
+                EpochReclaimer::guard g(self);
+                list.push_back(i);
+                list.pop_front(self);
+            }
+        });
+        printRow("private: epoch", threads, epoch / (double(ops) * threads));
+
+        HazardPointerReclaimer<2> hazards(threads);
+        double hazard = timeThreads(threads, [&](int) {
+            HazardPointerReclaimer<2>::participant self(hazards);
+            HazardPointerReclaimer<2>::guard g(self);
+            SinglyLinkedList<int> list;
+            for (int i = 0; i < ops; ++i) {
+                list.push_back(i);
+                list.protect_front(g);
+                g.reset();
+                list.pop_front(self);
+            }
+        });
+        printRow("private: hazard pointers", threads, hazard / (double(ops) * threads));
+
+        printRow("shared: epoch", threads, sharedListRun<EpochReclaimer>(threads, ops / 4));
+        printRow("shared: hazard pointers", threads, sharedListRun<HazardPointerReclaimer<2>>(threads, ops / 4));
+    }
+}
+/**
+ * Every thread pushes and pops on its own list, and the lists sit next to each
+ * other in one array. With CompactLayout several lists share a cache line, so
+ * the threads invalidate each other's lines even though they never share data.
+ */
+template <typename List>
+double adjacentListsRun(int threads, int ops) {
+    std::vector<List> lists(threads);
+    double ns = timeThreads(threads, [&](int t) {
+        List &mine = lists[t];
+        for (int i = 0; i < ops; ++i) {
+            mine.push_back(i);
+            if (mine.size() > 8) mine.pop_front();
+        }
+    });
+    return ns / (double(ops) * threads);
+}
+
+/**
+ * A producer and a consumer hand elements over through per-pair lists, each
+ * guarded by its own mutex stored next to the list. Pairs are packed into one
+ * array, so adjacent pairs contend on shared cache lines in the compact layout.
+ */
+template <typename List>
+double producerConsumerRun(int pairs, int ops) {
+    struct Channel {
+        std::mutex lock;
+        List list;
+    };
+    std::vector<Channel> channels(pairs);
+    double ns = timeThreads(2 * pairs, [&](int t) {
+        Channel &ch = channels[t / 2];
+        if (t % 2 == 0) {
+            for (int i = 0; i < ops; ++i) {
+                std::lock_guard<std::mutex> hold(ch.lock);
+                ch.list.push_back(i);
+            }
+        } else {
+            for (int taken = 0; taken < ops;) {
+                std::lock_guard<std::mutex> hold(ch.lock);
+                if (!ch.list.empty()) { ch.list.pop_front(); ++taken; }
+            }
+        }
+    });
+    return ns / (double(ops) * pairs);
+}
+
+void benchCacheAlignedLayout() {
+    std::cout << "\n========== FALSE SHARING: COMPACT VS CACHE-ALIGNED (ns per op) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "layout" << std::right << std::setw(8) << "threads"
+              << std::setw(14) << "ns/op" << std::endl;
+
+    using Compact = SinglyLinkedList<int>;
+    using Aligned = SinglyLinkedList<int, CacheAlignedLayout<>>;
+    using AlignedNodes = SinglyLinkedList<int, CacheAlignedLayout<true>>;
+    const int ops = 500000;
+    for (int threads = 2; threads <= 16; threads *= 2) {
+        printRow("adjacent: compact", threads, adjacentListsRun<Compact>(threads, ops));
+        printRow("adjacent: aligned", threads, adjacentListsRun<Aligned>(threads, ops));
+        printRow("adjacent: aligned nodes", threads, adjacentListsRun<AlignedNodes>(threads, ops));
+        printRow("prod/cons: compact", threads, producerConsumerRun<Compact>(threads / 2, ops / 4));
+        printRow("prod/cons: aligned", threads, producerConsumerRun<Aligned>(threads / 2, ops / 4));
+    }
+}
+
+template <std::size_t Bytes>
+struct BigRecord {
+    std::uint64_t key;
+    char payload[Bytes - sizeof(std::uint64_t)];
+    explicit BigRecord(std::uint64_t k) : key(k), payload{} {}
+};
+
+// Scans (find_if on a missing key) and sorts a list of `Bytes`-sized records,
+// comparing the plain list against the split hot/cold list.
+template <std::size_t Bytes>
+void benchSplitFor(std::size_t n) {
+    using Big = BigRecord<Bytes>;
+    auto by_key = [](const Big& r) { return r.key; };
+    SinglyLinkedList<Big> plain;
+    SplitSinglyLinkedList<Big, decltype(by_key)> split(by_key);
+    std::uint64_t x = 88172645463325252ull;
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        plain.emplace_back(x % n);
+        split.emplace_back(x % n);
+    }
+
+    const int rounds = 20;
+    auto start = Clock::now();
+    std::size_t hits = 0;
+    for (int r = 0; r < rounds; ++r)
+        hits += std::find_if(plain.begin(), plain.end(), [&](const Big& b) { return b.key == n; }) != plain.end();
+    double plain_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (int r = 0; r < rounds; ++r)
+        hits += split.find_if([&](std::uint64_t k) { return k == n; }) != split.end();
+    double split_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    start = Clock::now();
+    plain.sort([](const Big& a, const Big& b) { return a.key < b.key; });
+    double plain_sort_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    start = Clock::now();
+    split.sort();
+    double split_sort_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    std::string size = std::to_string(Bytes) + "B";
+    printRow("find_if plain " + size, 1, plain_ns / (double(n) * rounds));
+    printRow("find_if split " + size, 1, split_ns / (double(n) * rounds));
+    printRow("sort plain " + size, 1, plain_sort_ns / double(n));
+    printRow("sort split " + size, 1, split_sort_ns / double(n));
+    if (hits) std::cout << "unexpected hit" << std::endl;
+}
+
+void benchSplitNodes() {
+    std::cout << "\n========== HOT/COLD SPLIT NODES (ns per element) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "operation" << std::right << std::setw(8) << "threads"
+              << std::setw(14) << "ns/elem" << std::endl;
+    benchSplitFor<256>(200000);
+    benchSplitFor<1024>(100000);
+}
+
+void benchBackPoppable() {
+    std::cout << "\n========== DRAINING WITH pop_back (ns per pop) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "mode" << std::right << std::setw(8) << "N"
+              << std::setw(14) << "ns/op" << std::endl;
+    for (int n : {1000, 10000, 50000}) {
+        for (bool tracked : {false, true}) {
+            SinglyLinkedList<int> list;
+            list.set_back_poppable(tracked);
+            list.generate_back_n(n, [i = 0]() mutable { return i++; });
+            auto start = Clock::now();
+            while (!list.empty()) list.pop_back();
+            double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            printRow(tracked ? "back-poppable" : "plain walk", n, ns / n);
+        }
+    }
+}
+
+void benchMergeK() {
+    std::cout << "\n========== K-WAY MERGE WITH A LOSER TREE (per element) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "k" << std::right << std::setw(8) << "cmp/el"
+              << std::setw(14) << "ns/elem" << std::endl;
+    const std::size_t total = 1 << 20;
+    for (std::size_t k = 2; k <= 1024; k *= 2) {
+        std::vector<SinglyLinkedList<std::uint64_t>> runs(k);
+        std::uint64_t x = 88172645463325252ull;
+        for (std::size_t i = 0; i < total; ++i) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            runs[i % k].push_back(x % total);
+        }
+        // Each run must be sorted; merge_k with a single run returns it unchanged.
+        for (auto& run : runs) {
+            std::vector<std::uint64_t> values(run.begin(), run.end());
+            std::sort(values.begin(), values.end());
+            run.clear();
+            for (auto v : values) run.push_back(v);
+        }
+        std::size_t comparisons = 0;
+        auto counting = [&](std::uint64_t a, std::uint64_t b) { ++comparisons; return a < b; };
+        auto start = Clock::now();
+        auto merged = SinglyLinkedList<std::uint64_t>::merge_k(runs, counting);
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        std::cout << std::left << std::setw(28) << k << std::right << std::setw(8) << std::fixed
+                  << std::setprecision(2) << double(comparisons) / total << std::setw(14)
+                  << std::setprecision(1) << ns / total << std::endl;
+        if (merged.size() != total) std::cout << "size mismatch" << std::endl;
+    }
+}
+
+void benchSelection() {
+    std::cout << "\n========== SELECTION VS FULL SORT (ns per element) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "operation" << std::right << std::setw(8) << "k"
+              << std::setw(14) << "ns/elem" << std::endl;
+    const std::size_t n = 2000000;
+    SinglyLinkedList<std::uint64_t> source;
+    std::uint64_t x = 88172645463325252ull;
+    source.generate_back_n(n, [&x] { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; });
+
+    auto time = [&](const std::string& name, std::size_t k, auto fn) {
+        SinglyLinkedList<std::uint64_t> list = source;
+        auto start = Clock::now();
+        fn(list);
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        printRow(name, int(k), ns / n);
+    };
+    time("sort", 0, [](SinglyLinkedList<std::uint64_t>& l) { l.sort(); });
+    for (std::size_t k : {10, 1000, 100000}) {
+        time("top_k", k, [k](SinglyLinkedList<std::uint64_t>& l) { l.top_k(k); });
+        time("sort + truncate", k, [k](SinglyLinkedList<std::uint64_t>& l) { l.sort(); l.resize(k); });
+    }
+    time("nth_element (median)", n / 2, [](SinglyLinkedList<std::uint64_t>& l) { l.nth_element(n / 2); });
+}
+
+// Round-robin over `tasks` entries: pop_front + push_back on the plain list
+// (a free and an allocation per tick) against rotate() on the ring.
+void benchRoundRobin() {
+    std::cout << "\n========== ROUND-ROBIN TICK (ns per tick) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "scheme" << std::right << std::setw(8) << "tasks"
+              << std::setw(14) << "ns/tick" << std::endl;
+    const int ticks = 2000000;
+    for (int tasks : {8, 1024}) {
+        SinglyLinkedList<std::string> plain;
+        CircularSinglyLinkedList<std::string> ring;
+        for (int i = 0; i < tasks; ++i) {
+            plain.push_back("task-" + std::to_string(i) + std::string(24, '.'));
+            ring.push_back("task-" + std::to_string(i) + std::string(24, '.'));
+        }
+        std::size_t work = 0;
+        auto start = Clock::now();
+        for (int t = 0; t < ticks; ++t) {
+            std::string current = std::move(plain.front());
+            work += current.size();
+            plain.pop_front();
+            plain.push_back(std::move(current));
+        }
+        printRow("pop_front + push_back", tasks, std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ticks);
+
+        start = Clock::now();
+        for (int t = 0; t < ticks; ++t) {
+            work += ring.front().size();
+            ring.rotate();
+        }
+        printRow("circular rotate()", tasks, std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ticks);
+        if (work == 0) std::cout << "no work" << std::endl;
+    }
+}
+
+
+// Single-source shortest paths on a random sparse graph (CSR arrays).
+// std::priority_queue has no decrease-key, so it pushes a duplicate and
+// skips stale entries on pop; the pairing heap updates in place by handle.
+struct Graph {
+    std::vector<std::uint32_t> offsets, targets, weights;
+};
+
+Graph randomGraph(std::uint32_t n, std::uint32_t degree, std::uint32_t max_weight) {
+    Graph g;
+    g.offsets.resize(n + 1);
+    std::uint64_t x = 88172645463325252ull;
+    for (std::uint32_t v = 0; v <= n; ++v) g.offsets[v] = v * degree;
+    for (std::uint64_t e = 0; e < std::uint64_t(n) * degree; ++e) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        g.targets.push_back(std::uint32_t(x % n));
+        g.weights.push_back(std::uint32_t((x >> 32) % max_weight) + 1);
+    }
+    return g;
+}
+
+std::vector<std::uint64_t> dijkstraBinaryHeap(const Graph& g, std::size_t& heap_ops) {
+    const std::uint32_t n = std::uint32_t(g.offsets.size() - 1);
+    std::vector<std::uint64_t> dist(n, UINT64_MAX);
+    using Entry = std::pair<std::uint64_t, std::uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    dist[0] = 0;
+    queue.push({0, 0});
+    while (!queue.empty()) {
+        auto [d, v] = queue.top();
+        queue.pop();
+        ++heap_ops;
+        if (d != dist[v]) continue; // Stale duplicate
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint64_t nd = d + g.weights[e];
+            if (nd < dist[g.targets[e]]) {
+                dist[g.targets[e]] = nd;
+                queue.push({nd, g.targets[e]});
+                ++heap_ops;
+            }
+        }
+    }
+    return dist;
+}
+
+std::vector<std::uint64_t> dijkstraPairingHeap(const Graph& g, std::size_t& heap_ops) {
+    const std::uint32_t n = std::uint32_t(g.offsets.size() - 1);
+    std::vector<std::uint64_t> dist(n, UINT64_MAX);
+    using Entry = std::pair<std::uint64_t, std::uint32_t>;
+    PairingHeap<Entry> queue;
+    std::vector<PairingHeap<Entry>::handle> where(n);
+    std::vector<bool> done(n, false);
+    dist[0] = 0;
+    where[0] = queue.push({0, 0});
+    while (!queue.empty()) {
+        std::uint32_t v = queue.top().second;
+        queue.pop();
+        ++heap_ops;
+        done[v] = true;
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint32_t u = g.targets[e];
+            std::uint64_t nd = dist[v] + g.weights[e];
+            if (done[u] || nd >= dist[u]) continue;
+            if (dist[u] == UINT64_MAX) where[u] = queue.push({nd, u});
+            else queue.decrease_key(where[u], {nd, u});
+            dist[u] = nd;
+            ++heap_ops;
+        }
+    }
+    return dist;
+}
+
+void benchDijkstra() {
+    std::cout << "\n========== DIJKSTRA: BINARY HEAP VS PAIRING HEAP (ms per run) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "queue" << std::right << std::setw(8) << "degree"
+              << std::setw(14) << "ms" << std::setw(14) << "heap ops" << std::endl;
+    const std::uint32_t n = 1 << 20;
+    for (std::uint32_t degree : {4, 16}) {
+        Graph g = randomGraph(n, degree, 1000);
+        std::size_t ops_binary = 0, ops_pairing = 0;
+        auto start = Clock::now();
+        auto a = dijkstraBinaryHeap(g, ops_binary);
+        double ms_binary = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        start = Clock::now();
+        auto b = dijkstraPairingHeap(g, ops_pairing);
+        double ms_pairing = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << std::left << std::setw(28) << "std::priority_queue (lazy)" << std::right << std::setw(8) << degree
+                  << std::setw(14) << std::fixed << std::setprecision(1) << ms_binary << std::setw(14) << ops_binary << std::endl;
+        std::cout << std::left << std::setw(28) << "PairingHeap (decrease_key)" << std::right << std::setw(8) << degree
+                  << std::setw(14) << ms_pairing << std::setw(14) << ops_pairing << std::endl;
+        if (a != b) std::cout << "distance mismatch" << std::endl;
+    }
+}
+
+// Discrete-event hold model: pop the earliest event, schedule one follow-up
+// a random delay later. Keys only grow, which is all a radix heap needs.
+void benchEventQueue() {
+    std::cout << "\n========== MONOTONE EVENT QUEUE (ns per event) ==========\n" << std::endl;
+    std::cout << std::left << std::setw(28) << "queue" << std::right << std::setw(8) << "pending"
+              << std::setw(14) << "ns/event" << std::endl;
+    const std::size_t events = 10000000;
+    using Event = std::pair<std::uint64_t, std::uint32_t>;
+    for (std::size_t pending : {std::size_t(1000), std::size_t(1000000)}) {
+        std::uint64_t checksum = 0;
+        auto run = [&](const std::string& name, auto&& push, auto&& take) {
+            std::uint64_t x = 88172645463325252ull;
+            auto delay = [&x] { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x % (1u << 20); };
+            for (std::size_t i = 0; i < pending; ++i) push(delay(), std::uint32_t(i));
+            auto start = Clock::now();
+            for (std::size_t i = 0; i < events; ++i) {
+                Event e = take();
+                checksum += e.first ^ e.second;
+                push(e.first + delay(), e.second);
+            }
+            printRow(name, int(pending), std::chrono::duration<double, std::nano>(Clock::now() - start).count() / events);
+        };
+
+        std::priority_queue<Event, std::vector<Event>, std::greater<Event>> binary;
+        run("std::priority_queue",
+            [&](std::uint64_t t, std::uint32_t id) { binary.push({t, id}); },
+            [&] { Event e = binary.top(); binary.pop(); return e; });
+
+        PairingHeap<Event> pairing;
+        run("PairingHeap",
+            [&](std::uint64_t t, std::uint32_t id) { pairing.push({t, id}); },
+            [&] { Event e = pairing.top(); pairing.pop(); return e; });
+
+        RadixHeap<std::uint64_t, std::uint32_t> radix;
+        run("RadixHeap",
+            [&](std::uint64_t t, std::uint32_t id) { radix.push(t, id); },
+            [&] { Event e{radix.top_key(), radix.top()}; radix.pop(); return e; });
+        if (checksum == 0) std::cout << "no work" << std::endl;
+    }
+}
+
+// Usage: ./bench [section...]   e.g. ./bench layout. With no arguments every section runs.
+int main(int argc, char** argv) {
+    std::vector<std::string> only(argv + 1, argv + argc);
+    auto selected = [&](const std::string& name) {
+        return only.empty() || std::find(only.begin(), only.end(), name) != only.end();
+    };
+
+    std::cout << "--- SINGLY LINKED LIST BENCHMARKS ---" << std::endl;
+
+    if (selected("reclamation")) benchReclamation();
+    if (selected("layout")) benchCacheAlignedLayout();
+    if (selected("split")) benchSplitNodes();
+    if (selected("backpop")) benchBackPoppable();
+    if (selected("mergek")) benchMergeK();
+    if (selected("select")) benchSelection();
+    if (selected("roundrobin")) benchRoundRobin();
+    if (selected("dijkstra")) benchDijkstra();
+    if (selected("events")) benchEventQueue();
+
+    std::cout << "\n--- ALL BENCHMARKS COMPLETED ---" << std::endl;
+
+    return 0;
+}
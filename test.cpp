@@ -2,13 +2,30 @@
 #include <string>
 #include <vector>
 #include <cassert> // For basic assertions
+#include <atomic>
+#include <cctype>
+#include <set>
 
 // Include the header file for the linked list library
 #include "SinglyLinkedList.h"
+#include "MemoryReclamation.h"
+#include "NumaArena.h"
+#include "SplitSinglyLinkedList.h"
+#include "ExternalSort.h"
+#include "BloomFilteredList.h"
+#include "IndexedSinglyLinkedList.h"
+#include "LazyDeletionList.h"
+#include "CircularSinglyLinkedList.h"
+#include "ListPool.h"
+#include "RunLengthList.h"
+#include "Rope.h"
+#include "PairingHeap.h"
+#include "RadixHeap.h"
+#include "SparseVector.h"
 
 // A helper function to print the contents and state of a list
-template <typename T>
-void printList(const SinglyLinkedList<T>& list, const std::string& name) {
+template <typename T, typename Layout>
+void printList(const SinglyLinkedList<T, Layout>& list, const std::string& name) {
     std::cout << "--- List '" << name << "' ---" << std::endl;
     std::cout << "Size: " << list.size() << ", Empty: " << (list.empty() ? "Yes" : "No") << std::endl;
     
@@ -265,6 +282,1204 @@ void testComparisons() {
     std::cout << "l1 >= l2: " << (l1 >= l2) << " (Expected: true)" << std::endl;
 }
 
+// Counts live instances so tests can observe when nodes are actually freed.
+struct Tracked {
+    static int alive;
+    int value;
+    Tracked(int v) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+void testReclamation() {
+    std::cout << "\n========== 7. TESTING DEFERRED RECLAMATION ==========\n" << std::endl;
+
+    EpochReclaimer domain(8, 4);
+    {
+        SinglyLinkedList<Tracked> list;
+        for (int i = 0; i < 6; ++i) list.emplace_back(i);
+        EpochReclaimer::participant self(domain);
+
+        {
+            EpochReclaimer::guard g(self);
+            std::cout << "--> pop_front(reclaimer) x3 inside a guard" << std::endl;
+            for (int i = 0; i < 3; ++i) list.pop_front(self);
+            self.collect();
+            std::cout << "Pending while pinned: " << self.pending() << " (Expected: 3)" << std::endl;
+            assert(self.pending() == 3 && Tracked::alive == 6);
+        }
+
+        std::cout << "--> erase_after(begin(), reclaimer)" << std::endl;
+        list.erase_after(list.begin(), self);
+        assert(list.size() == 2 && list.front().value == 3 && list.back().value == 5);
+        for (int i = 0; i < 3; ++i) self.collect();
+        std::cout << "Pending after guard released: " << self.pending() << " (Expected: 0)" << std::endl;
+        assert(self.pending() == 0 && Tracked::alive == 2);
+    }
+    assert(Tracked::alive == 0);
+
+    HazardPointerReclaimer<2> hazards(8, 1);
+    {
+        HazardPointerReclaimer<2>::participant self(hazards);
+        SinglyLinkedList<Tracked> list = {Tracked(1), Tracked(2)};
+
+        HazardPointerReclaimer<2>::guard g(self);
+        auto protected_it = list.protect_front(g);
+        std::cout << "Protected value: " << protected_it->value << std::endl;
+        list.pop_front(self);
+        std::cout << "Pending while protected: " << self.pending() << " (Expected: 1)" << std::endl;
+        assert(self.pending() == 1 && Tracked::alive == 2);
+        g.reset();
+        self.collect();
+        std::cout << "Pending after reset: " << self.pending() << " (Expected: 0)" << std::endl;
+        assert(self.pending() == 0 && Tracked::alive == 1);
+
+        // Same check on a type whose Node is not standard-layout.
+        SinglyLinkedList<std::string> names = {"a", "b"};
+        HazardPointerReclaimer<2>::guard g2(self);
+        auto name_it = names.protect_next(g2, names.cbegin());
+        names.erase_after(names.cbegin(), self);
+        assert(self.pending() == 1 && *name_it == "b");
+        g2.reset();
+        self.collect();
+        assert(self.pending() == 0);
+    }
+    assert(Tracked::alive == 0);
+}
+
+void testNumaPlacement() {
+    std::cout << "\n========== 8. TESTING NUMA PLACEMENT ==========\n" << std::endl;
+
+    std::cout << "NUMA nodes: " << numa::node_count() << ", local node: " << numa::local_node() << std::endl;
+
+    NumaArena arena; // Local node
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 10000; ++i) values.push_back(i);
+    std::cout << "Arena node " << arena.node() << ", mapped bytes: " << arena.mapped_bytes() << std::endl;
+    assert(values[9999] == 9999 && arena.mapped_bytes() >= 10000 * sizeof(int));
+
+    // Nodes allocated from the local node's arena through the layout hook.
+    {
+        using Local = NumaLayout<>;
+        SinglyLinkedList<int, Local> placed;
+        for (int i = 0; i < 1000; ++i) placed.push_back(i);
+        std::size_t mapped = Local::arena().mapped_bytes();
+        assert(mapped > 0 && placed.size() == 1000 && placed.back() == 999);
+        placed.clear();
+        for (int i = 0; i < 1000; ++i) placed.push_front(i); // Reuses the freed nodes
+        assert(Local::arena().mapped_bytes() == mapped && placed.front() == 999);
+        SinglyLinkedList<int, NumaLayout<-1, CacheAlignedLayout<true>>> aligned{1, 2, 3};
+        assert(reinterpret_cast<std::uintptr_t>(&aligned.front()) % SLL_CACHE_LINE_SIZE == 0);
+        std::cout << "Arena behind NumaLayout<> mapped " << mapped << " bytes for 1000 nodes" << std::endl;
+    }
+
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+    std::size_t pages = migrate_to_node(list);
+    std::cout << "Pages on local node after migrate_to_node(): " << pages << std::endl;
+    assert(pages > 0 && list.size() == 1000 && list.back() == 999);
+
+    try {
+        migrate_to_node(list, numa::node_count());
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+}
+
+void testCacheAlignedLayout() {
+    std::cout << "\n========== 9. TESTING CACHE-ALIGNED LAYOUT ==========\n" << std::endl;
+
+    using Padded = SinglyLinkedList<int, CacheAlignedLayout<true>>;
+    std::cout << "sizeof compact list: " << sizeof(SinglyLinkedList<int>)
+              << ", sizeof padded list: " << sizeof(Padded) << std::endl;
+    static_assert(alignof(Padded) == SLL_CACHE_LINE_SIZE, "padded list must start on a cache line");
+    static_assert(sizeof(Padded) >= 3 * SLL_CACHE_LINE_SIZE, "head_, tail_ and size each get a cache line");
+    static_assert(sizeof(SinglyLinkedList<int>) < SLL_CACHE_LINE_SIZE, "default layout stays compact");
+
+    Padded lists[2] = {{1, 2, 3}, {4, 5}};
+    lists[0].push_back(4);
+    lists[1].pop_front();
+    for (auto it = lists[0].begin(); it != lists[0].end(); ++it)
+        assert(reinterpret_cast<std::uintptr_t>(&*it) % SLL_CACHE_LINE_SIZE == 0);
+    std::cout << "Node addresses are cache-line aligned" << std::endl;
+    Padded copy = lists[0];
+    assert(copy == lists[0] && copy.back() == 4 && lists[1].front() == 5);
+    printList(lists[0], "padded list");
+}
+
+// A large record whose only hot field is `id`.
+struct Record {
+    int id;
+    char payload[256];
+    explicit Record(int i) : id(i), payload{} { payload[0] = static_cast<char>('a' + i % 26); }
+};
+
+void testSplitNodes() {
+    std::cout << "\n========== 10. TESTING SPLIT HOT/COLD NODES ==========\n" << std::endl;
+
+    auto by_id = [](const Record& r) { return r.id; };
+    SplitSinglyLinkedList<Record, decltype(by_id)> records(by_id);
+    for (int id : {5, 3, 9, 1, 3}) records.emplace_back(id);
+
+    auto it = records.find_if([](int key) { return key > 4; });
+    std::cout << "find_if(key > 4): " << it.key() << " (Expected: 5)" << std::endl;
+    assert(it != records.end() && it->id == 5);
+
+    records.sort();
+    std::cout << "After sort(): ";
+    for (auto r = records.begin(); r != records.end(); ++r) std::cout << r.key() << " ";
+    std::cout << std::endl;
+    assert(records.front().id == 1 && records.back().id == 9 && records.size() == 5);
+
+    SplitSinglyLinkedList<Record, decltype(by_id)> more(by_id);
+    for (int id : {2, 4, 10}) more.emplace_back(id);
+    records.merge(more);
+    std::cout << "After merge(): ";
+    int previous = 0;
+    for (auto r = records.begin(); r != records.end(); ++r) {
+        std::cout << r.key() << " ";
+        assert(r.key() >= previous && r.key() == r->id);
+        previous = r.key();
+    }
+    std::cout << std::endl;
+    assert(records.size() == 8 && more.empty() && records.back().id == 10);
+
+    records.modify(records.begin(), [](Record& r) { r.id = 42; });
+    assert(records.begin().key() == 42 && records.front().id == 42);
+    std::cout << "modify() refreshed the cached key: " << records.begin().key() << std::endl;
+
+    // A throwing key comparator leaves every element in place, in some order.
+    int calls = 0;
+    bool threw = false;
+    try {
+        records.sort([&calls](int a, int b) {
+            if (++calls == 6) throw std::runtime_error("comparator");
+            return a < b;
+        });
+    } catch (const std::runtime_error&) { threw = true; }
+    assert(threw && records.size() == 8);
+    std::vector<int> keys;
+    for (auto r = records.begin(); r != records.end(); ++r) keys.push_back(r.key());
+    std::sort(keys.begin(), keys.end());
+    assert(keys == (std::vector<int>{2, 3, 3, 4, 5, 9, 10, 42}));
+    records.emplace_back(7); // tail_ still valid
+    assert(records.back().id == 7);
+
+    // Long chains are freed iteratively, by clear() and by the destructor.
+    auto identity = [](int v) { return v; };
+    for (int pass = 0; pass < 2; ++pass) {
+        SplitSinglyLinkedList<int, decltype(identity)> ints(identity);
+        for (int i = 0; i < 1000000; ++i) ints.push_back(i);
+        if (pass == 0) ints.clear();
+        assert(pass == 1 || ints.empty());
+    }
+}
+
+// Throws on the Nth construction so tests can check the strong exception guarantee.
+struct FailingCtor {
+    static int countdown;
+    int value;
+    explicit FailingCtor(int v) : value(v) {
+        if (--countdown == 0) throw std::runtime_error("construction failed");
+    }
+};
+int FailingCtor::countdown = 0;
+
+void testBatchedAppend() {
+    std::cout << "\n========== 11. TESTING BATCHED APPEND AND RESIZE ==========\n" << std::endl;
+
+    SinglyLinkedList<std::string> words = {"a"};
+    std::cout << "--> emplace_back_n(3, 2, 'x')" << std::endl;
+    words.emplace_back_n(3, 2, 'x');
+    printList(words, "words");
+    assert(words.size() == 4 && words.back() == "xx");
+
+    SinglyLinkedList<int> squares;
+    int i = 0;
+    std::cout << "--> generate_back_n(5, squares)" << std::endl;
+    squares.generate_back_n(5, [&] { ++i; return i * i; });
+    printList(squares, "squares");
+    assert(squares.size() == 5 && squares.front() == 1 && squares.back() == 25);
+
+    std::cout << "--> resize(2), resize(4, 7), resize(5)" << std::endl;
+    squares.resize(2);
+    assert(squares.size() == 2 && squares.back() == 4);
+    squares.resize(4, 7);
+    squares.resize(5);
+    printList(squares, "squares");
+    assert(squares == (SinglyLinkedList<int>{1, 4, 7, 7, 0}));
+    squares.resize(0);
+    assert(squares.empty());
+    squares.push_back(3); // tail_ must be reset by resize(0)
+    assert(squares.front() == 3 && squares.back() == 3);
+
+    SinglyLinkedList<FailingCtor> failing;
+    failing.emplace_back_n(2, 1);
+    FailingCtor::countdown = 3;
+    try {
+        std::cout << "--> emplace_back_n(5, ...) failing on the 3rd element" << std::endl;
+        failing.emplace_back_n(5, 9);
+    } catch (const std::runtime_error& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+    assert(failing.size() == 2 && failing.back().value == 1);
+    std::cout << "List unchanged after failure, size: " << failing.size() << std::endl;
+}
+
+void testBackPoppable() {
+    std::cout << "\n========== 12. TESTING BACK-POPPABLE MODE AND pop_back_n ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list;
+    list.set_back_poppable(true);
+    list.generate_back_n(1000, [n = 0]() mutable { return n++; });
+    std::cout << "--> draining 1000 elements with pop_back()" << std::endl;
+    for (int expected = 999; expected >= 0; --expected) {
+        assert(list.back() == expected);
+        list.pop_back();
+    }
+    assert(list.empty());
+
+    // Mixed workload checked against a std::vector model.
+    std::vector<int> model;
+    unsigned x = 12345;
+    for (int step = 0; step < 20000; ++step) {
+        x = x * 1103515245u + 12345u;
+        unsigned op = (x >> 16) % 10;
+        if (op < 4 || model.empty()) {
+            list.push_back(step);
+            model.push_back(step);
+        } else if (op < 8) {
+            list.pop_back();
+            model.pop_back();
+        } else if (op == 8) {
+            list.push_front(-step);
+            model.insert(model.begin(), -step);
+        } else {
+            list.insert_after(list.begin(), step);
+            model.insert(model.begin() + 1, step);
+        }
+        assert(list.size() == model.size());
+        if (!model.empty()) assert(list.back() == model.back());
+    }
+    assert(std::equal(list.begin(), list.end(), model.begin()));
+    std::cout << "Mixed workload matches the reference, size: " << list.size() << std::endl;
+
+    SinglyLinkedList<int> copy = list;
+    assert(copy.back_poppable() && copy == list);
+
+    SinglyLinkedList<int> numbers = {1, 2, 3, 4, 5, 6};
+    std::cout << "--> pop_back_n(4)" << std::endl;
+    numbers.pop_back_n(4);
+    printList(numbers, "numbers");
+    assert(numbers.size() == 2 && numbers.back() == 2);
+    numbers.push_back(9);
+    assert(numbers.back() == 9);
+    try {
+        numbers.pop_back_n(4);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+    numbers.pop_back_n(3);
+    assert(numbers.empty());
+}
+
+void testReverseView() {
+    std::cout << "\n========== 13. TESTING REVERSE VIEW ==========\n" << std::endl;
+
+    for (ReverseBuffering mode : {ReverseBuffering::recompute, ReverseBuffering::block}) {
+        for (int n : {0, 1, 2, 9, 10, 37}) {
+            SinglyLinkedList<int> list;
+            list.generate_back_n(n, [i = 0]() mutable { return i++; });
+            auto view = list.reverse_view(mode);
+            int expected = n - 1;
+            for (int value : view) assert(value == expected--);
+            assert(expected == -1 && view.size() == static_cast<std::size_t>(n));
+        }
+    }
+
+    const SinglyLinkedList<std::string> words = {"one", "two", "three"};
+    std::cout << "reverse_view(): ";
+    for (const auto& w : words.reverse_view(ReverseBuffering::block)) std::cout << w << " ";
+    std::cout << "(Expected: three two one)" << std::endl;
+    printList(words, "words (unchanged)");
+}
+
+void testCursor() {
+    std::cout << "\n========== 14. TESTING CURSOR EDITS ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list = {1, 2, 3, 4, 5, 6};
+    std::cout << "--> one pass: drop evens, square odds, add a 0 before 5 and a -3 after it" << std::endl;
+    for (auto c = list.cursor_begin(); !c.at_end();) {
+        if (*c % 2 == 0) {
+            c.erase();
+            continue;
+        }
+        if (*c == 5) {
+            c.insert_before(0);
+            c.insert_after(-3); // Visited next, so it gets squared too
+        }
+        c.replace(*c * *c);
+        c.advance();
+    }
+    printList(list, "edited");
+    assert(list == (SinglyLinkedList<int>{1, 9, 0, 25, 9}));
+    assert(list.back() == 9);
+
+    SinglyLinkedList<int> single = {7};
+    auto c = single.cursor_begin();
+    c.erase();
+    assert(single.empty() && c.at_end());
+    c.insert_before(8); // Appends at the end
+    c.insert_before(9);
+    assert(single == (SinglyLinkedList<int>{8, 9}) && single.back() == 9);
+    try {
+        c.advance();
+    } catch (const std::out_of_range& e) {
+        std::cout << "Caught expected exception: " << e.what() << std::endl;
+    }
+}
+
+void testInsertSorted() {
+    std::cout << "\n========== 15. TESTING SORTED INSERTION ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list;
+    for (int v : {5, 1, 9, 5, 3, 12, 0}) list.insert_sorted(v);
+    printList(list, "insert_sorted");
+    assert(list == (SinglyLinkedList<int>{0, 1, 3, 5, 5, 9, 12}) && list.back() == 12);
+
+    // Nearly sorted stream: each insert starts from the previous one.
+    SinglyLinkedList<int> stream;
+    auto hint = stream.cbegin();
+    for (int v : {1, 2, 4, 3, 5, 7, 6, 8, 0, 9}) hint = stream.insert_sorted(hint, v);
+    printList(stream, "insert_sorted(hint, value)");
+    assert(stream == (SinglyLinkedList<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}) && stream.back() == 9);
+
+    SinglyLinkedList<std::string> desc;
+    for (const char* w : {"b", "d", "a", "c"}) desc.insert_sorted(w, std::greater<std::string>());
+    assert(desc == (SinglyLinkedList<std::string>{"d", "c", "b", "a"}));
+}
+
+
+void testRelinking() {
+    std::cout << "\n========== 16. TESTING ROTATE AND RANGE RELINKING ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list{0, 1, 2, 3, 4, 5};
+    const int* third = &*std::next(list.begin(), 2);
+    list.rotate(2);
+    printList(list, "rotate(2)");
+    assert(list == (SinglyLinkedList<int>{2, 3, 4, 5, 0, 1}) && list.back() == 1);
+    assert(&list.front() == third); // Nodes relinked, not copied
+    list.rotate(list.size() - 2);   // Rotate right by 2
+    assert(list == (SinglyLinkedList<int>{0, 1, 2, 3, 4, 5}));
+    list.rotate(12);
+    assert(list == (SinglyLinkedList<int>{0, 1, 2, 3, 4, 5}));
+
+    // Move (1, 4) = {2, 3} to the end, then the tail range back towards the front.
+    auto at = [&](int i) { return std::next(list.cbegin(), i); };
+    list.move_range_after(at(5), at(1), at(4));
+    printList(list, "move_range_after(last, 1, 4)");
+    assert(list == (SinglyLinkedList<int>{0, 1, 4, 5, 2, 3}) && list.back() == 3);
+    list.move_range_after(at(0), at(3), list.cend());
+    assert(list == (SinglyLinkedList<int>{0, 2, 3, 1, 4, 5}) && list.back() == 5);
+    list.move_range_after(at(2), at(0), at(1)); // Empty range: no-op
+    assert(list == (SinglyLinkedList<int>{0, 2, 3, 1, 4, 5}));
+
+    SinglyLinkedList<int> s{0, 1, 2, 3, 4, 5, 6, 7};
+    auto sat = [&](int i) { return std::next(s.cbegin(), i); };
+    s.swap_ranges_after(sat(0), sat(3), sat(4), s.cend()); // {1,2} <-> {5,6,7}
+    printList(s, "swap_ranges_after");
+    assert(s == (SinglyLinkedList<int>{0, 5, 6, 7, 3, 4, 1, 2}) && s.back() == 2);
+    s.swap_ranges_after(sat(5), s.cend(), sat(0), sat(4)); // Later range first: {1,2} <-> {5,6,7}
+    assert(s == (SinglyLinkedList<int>{0, 1, 2, 3, 4, 5, 6, 7}) && s.back() == 7);
+    s.swap_ranges_after(sat(2), sat(4), sat(3), sat(5)); // Adjacent: {3} <-> {4}
+    assert(s == (SinglyLinkedList<int>{0, 1, 2, 4, 3, 5, 6, 7}));
+    s.swap_ranges_after(sat(4), sat(6), sat(3), sat(5)); // Adjacent, reversed order: {5} <-> {3}
+    assert(s == (SinglyLinkedList<int>{0, 1, 2, 4, 5, 3, 6, 7}));
+    s.swap_ranges_after(sat(0), sat(1), sat(4), sat(6)); // One empty range
+    assert(s == (SinglyLinkedList<int>{0, 3, 1, 2, 4, 5, 6, 7}) && s.size() == 8);
+}
+
+
+void testMergeK() {
+    std::cout << "\n========== 17. TESTING K-WAY MERGE ==========\n" << std::endl;
+
+    std::vector<SinglyLinkedList<int>> runs;
+    runs.push_back({1, 4, 7, 10});
+    runs.push_back({});
+    runs.push_back({2, 5, 8});
+    runs.push_back({0, 3, 6, 9, 12});
+    runs.push_back({11});
+    const int* seven = &*std::next(runs[0].begin(), 2);
+    SinglyLinkedList<int> merged = SinglyLinkedList<int>::merge_k(runs);
+    printList(merged, "merge_k of 5 runs");
+    assert(merged == (SinglyLinkedList<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}));
+    assert(merged.size() == 13 && merged.back() == 12);
+    assert(&*std::next(merged.begin(), 7) == seven); // Spliced, not copied
+    for (const auto& run : runs) assert(run.empty());
+    merged.push_back(13); // tail_ is valid
+    assert(merged.back() == 13);
+
+    // Stability across lists, and a descending comparator.
+    std::vector<SinglyLinkedList<std::pair<int, char>>> tagged(3);
+    tagged[0].push_back({2, 'a'}); tagged[0].push_back({1, 'a'});
+    tagged[1].push_back({2, 'b'});
+    tagged[2].push_back({3, 'c'}); tagged[2].push_back({2, 'c'});
+    auto desc = [](const std::pair<int, char>& x, const std::pair<int, char>& y) { return x.first > y.first; };
+    auto out = SinglyLinkedList<std::pair<int, char>>::merge_k(tagged, desc);
+    std::string order;
+    for (const auto& p : out) order += char('0' + p.first), order += p.second;
+    assert(order == "3c2a2b2c1a");
+
+    std::vector<SinglyLinkedList<int>> none;
+    assert(SinglyLinkedList<int>::merge_k(none).empty());
+}
+
+
+void testSorting() {
+    std::cout << "\n========== 18. TESTING SORT AND EXTERNAL SORT ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list{5, 3, 9, 1, 5, 0, 7};
+    const int* nine = &*std::next(list.begin(), 2);
+    list.sort();
+    printList(list, "sort()");
+    assert(list == (SinglyLinkedList<int>{0, 1, 3, 5, 5, 7, 9}) && list.back() == 9);
+    assert(&list.back() == nine); // Relinked, not copied
+    list.sort(std::greater<int>());
+    assert(list == (SinglyLinkedList<int>{9, 7, 5, 5, 3, 1, 0}) && list.back() == 0);
+
+    SinglyLinkedList<std::pair<int, int>> pairs{{2, 0}, {1, 1}, {2, 2}, {1, 3}};
+    pairs.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+    assert(pairs == (SinglyLinkedList<std::pair<int, int>>{{1, 1}, {1, 3}, {2, 0}, {2, 2}})); // Stable
+
+    // A comparator that throws partway through must not cost any element.
+    for (int budget : {0, 1, 10, 200, 900}) {
+        SinglyLinkedList<int> l;
+        for (int i = 0; i < 300; ++i) l.push_back((i * 37) % 101);
+        std::vector<int> before(l.begin(), l.end());
+        int calls = 0;
+        bool threw = false;
+        try {
+            l.sort([&calls, budget](int a, int b) {
+                if (calls++ == budget) throw std::runtime_error("comparator");
+                return a < b;
+            });
+        } catch (const std::runtime_error&) { threw = true; }
+        assert(threw && l.size() == before.size());
+        std::vector<int> after(l.begin(), l.end());
+        std::sort(before.begin(), before.end());
+        std::sort(after.begin(), after.end());
+        assert(after == before);
+        l.push_back(-1); // tail_ still valid
+        assert(l.back() == -1 && l.size() == before.size() + 1);
+    }
+
+    // A budget of a few hundred bytes forces many spilled runs.
+    std::vector<long> input;
+    unsigned x = 12345;
+    for (int i = 0; i < 5000; ++i) input.push_back((x = x * 1103515245u + 12345u) % 1000);
+    ExternalSorter<long> sorter(std::less<long>(), 512);
+    sorter.push(input.begin(), input.end());
+    assert(sorter.spilled_runs() > 1);
+    std::vector<long> streamed(sorter.begin(), sorter.end());
+    std::vector<long> expected = input;
+    std::sort(expected.begin(), expected.end());
+    assert(streamed == expected);
+    std::cout << "external sort: " << input.size() << " elements through " << sorter.spilled_runs() << " runs" << std::endl;
+
+    SinglyLinkedList<long> rebuilt = external_sort(input.begin(), input.end(), std::greater<long>(), 4096);
+    assert(rebuilt.size() == input.size() && rebuilt.front() == 999 && rebuilt.back() == 0);
+    assert(std::is_sorted(rebuilt.begin(), rebuilt.end(), std::greater<long>()));
+
+    SinglyLinkedList<long> in_memory = external_sort(input.begin(), input.end()); // Fits: no spill
+    assert(std::equal(in_memory.begin(), in_memory.end(), expected.begin(), expected.end()));
+}
+
+
+void testSelection() {
+    std::cout << "\n========== 19. TESTING TOP-K AND NTH_ELEMENT ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list{8, 3, 9, 1, 7, 3, 0, 6, 2, 5};
+    SinglyLinkedList<int> best = list.top_k(4);
+    printList(best, "top_k(4)");
+    assert(best == (SinglyLinkedList<int>{0, 1, 2, 3}) && best.back() == 3);
+    assert(list.top_k(3, std::greater<int>()) == (SinglyLinkedList<int>{9, 8, 7}));
+    assert(list.top_k(50).size() == list.size() && list.top_k(0).empty());
+    assert(list.size() == 10 && list.front() == 8); // Source untouched
+
+    // Check every rank against a sorted copy, on input with many duplicates.
+    std::vector<int> values;
+    unsigned x = 7;
+    for (int i = 0; i < 300; ++i) values.push_back((x = x * 1103515245u + 12345u) % 40);
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(150), std::size_t(298), std::size_t(299)}) {
+        SinglyLinkedList<int> l;
+        l.generate_back_n(values.size(), [&values, i = 0]() mutable { return values[i++]; });
+        auto nth = l.nth_element(n);
+        assert(*nth == sorted[n] && l.size() == values.size());
+        std::size_t i = 0;
+        for (auto it = l.begin(); it != l.end(); ++it, ++i) {
+            if (i < n) assert(*it <= *nth);
+            if (i == n) assert(it == nth);
+            if (i > n) assert(*it >= *nth);
+        }
+        l.push_back(-1); // tail_ still valid
+        assert(l.back() == -1);
+    }
+
+    SinglyLinkedList<int> small{4, 2, 3};
+    assert(*small.nth_element(2, std::greater<int>()) == 2);
+    bool threw = false;
+    try { small.nth_element(3); } catch (const std::out_of_range&) { threw = true; }
+    assert(threw);
+
+    // A comparator that throws partway through, including on the last node of a round, keeps every element.
+    for (int budget : {0, 1, 2, 50, 299, 400}) {
+        SinglyLinkedList<int> l;
+        l.generate_back_n(values.size(), [&values, i = 0]() mutable { return values[i++]; });
+        int calls = 0;
+        threw = false;
+        try {
+            l.nth_element(150, [&calls, budget](int a, int b) {
+                if (calls++ == budget) throw std::runtime_error("comparator");
+                return a < b;
+            });
+        } catch (const std::runtime_error&) { threw = true; }
+        assert(threw && l.size() == values.size());
+        std::vector<int> after(l.begin(), l.end());
+        std::sort(after.begin(), after.end());
+        assert(after == sorted);
+        l.push_back(-1); // tail_ still valid
+        assert(l.back() == -1);
+    }
+    SinglyLinkedList<int> pair{2, 1};
+    threw = false;
+    try { pair.nth_element(0, [](int, int) -> bool { throw std::runtime_error("comparator"); }); }
+    catch (const std::runtime_error&) { threw = true; }
+    assert(threw && pair.size() == 2 && std::is_permutation(pair.begin(), pair.end(), std::begin({1, 2})));
+}
+
+
+void testDedupe() {
+    std::cout << "\n========== 20. TESTING HASH DEDUPLICATION ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list{4, 1, 4, 2, 1, 3, 2, 4, 5, 5};
+    const int* three = &*std::next(list.begin(), 5);
+    assert(list.dedupe() == 5);
+    printList(list, "dedupe()");
+    assert(list == (SinglyLinkedList<int>{4, 1, 2, 3, 5}) && list.size() == 5 && list.back() == 5);
+    assert(&*std::next(list.begin(), 3) == three); // Survivors are not copied
+    list.push_back(6);
+    assert(list.back() == 6 && list.dedupe() == 0);
+
+    // Custom hash/equality: case-insensitive words, first spelling wins.
+    SinglyLinkedList<std::string> words{"Apple", "pear", "APPLE", "Pear", "fig"};
+    auto lower = [](std::string s) { for (auto& c : s) c = char(std::tolower(c)); return s; };
+    std::size_t removed = words.dedupe([&](const std::string& s) { return std::hash<std::string>()(lower(s)); },
+                                       [&](const std::string& a, const std::string& b) { return lower(a) == lower(b); });
+    assert(removed == 2 && words == (SinglyLinkedList<std::string>{"Apple", "pear", "fig"}));
+
+    SinglyLinkedList<int> same{7, 7, 7};
+    assert(same.dedupe() == 2 && same.size() == 1 && same.back() == 7);
+}
+
+
+void testMembershipFilter() {
+    std::cout << "\n========== 21. TESTING FIND AND BLOOM-FILTERED MEMBERSHIP ==========\n" << std::endl;
+
+    SinglyLinkedList<int> plain{3, 1, 4, 1, 5};
+    assert(plain.find(1) == std::next(plain.begin()) && plain.find(9) == plain.end());
+    assert(plain.contains(5) && !plain.contains(2));
+    *plain.find(4) = 40;
+    assert(plain.contains(40));
+
+    BloomFilteredList<int> list;
+    for (int i = 0; i < 1000; i += 2) list.push_back(i); // Even numbers only
+    assert(list.size() == 500 && list.contains(998) && *list.find(10) == 10);
+    std::size_t found = 0;
+    for (int i = 1; i < 20000; i += 2) found += list.contains(i);
+    assert(found == 0);
+    auto stats = list.stats();
+    std::cout << "lookups " << stats.lookups << ", filtered " << stats.filtered << ", false positives "
+              << stats.false_positives << " (rate " << stats.false_positive_rate() << ", expected "
+              << stats.expected_fpr << ")" << std::endl;
+    assert(stats.filtered + stats.false_positives == 10000);
+    assert(stats.false_positive_rate() < 0.05 && stats.hashes == 7);
+
+    // Erasures pass the threshold: the next lookup rebuilds and stops admitting erased values.
+    std::size_t rebuilds = list.stats().rebuilds;
+    for (int i = 0; i < 400; i += 2) assert(list.remove(i));
+    assert(!list.remove(0) && !list.contains(0) && list.contains(400) && list.size() == 300);
+    assert(list.stats().rebuilds > rebuilds);
+    list.pop_front();
+    list.insert_after(list.begin(), 7);
+    assert(list.contains(7) && list.front() == 402);
+    list.clear();
+    assert(!list.contains(7) && list.empty());
+}
+
+
+void testIndexedList() {
+    std::cout << "\n========== 22. TESTING HASH-INDEXED LIST ==========\n" << std::endl;
+
+    struct Session { int id; std::string user; };
+    auto by_id = [](const Session& s) { return s.id; };
+    IndexedSinglyLinkedList<Session, decltype(by_id)> sessions(by_id);
+    auto ids = [&] {
+        std::string out;
+        for (const auto& s : sessions) out += std::to_string(s.id) + " ";
+        return out;
+    };
+    // Checks every predecessor in the index against a walk of the list.
+    auto consistent = [&] {
+        auto prev = sessions.cend();
+        for (auto it = sessions.cbegin(); it != sessions.cend(); prev = it, ++it) {
+            if (sessions.predecessor(it->id) != prev || sessions.find(it->id) != it) return false;
+        }
+        return sessions.empty() || &sessions.back() == &*prev;
+    };
+
+    for (int id : {3, 4, 5}) sessions.push_back({id, "u" + std::to_string(id)});
+    sessions.push_front({2, "u2"});
+    sessions.push_front({1, "u1"});
+    sessions.insert_after(sessions.find(3), {30, "u30"});
+    std::cout << "sessions: " << ids() << std::endl;
+    assert(ids() == "1 2 3 30 4 5 " && consistent());
+    assert(sessions.find(30)->user == "u30" && sessions.contains(5) && !sessions.contains(6));
+
+    bool threw = false;
+    try { sessions.push_back({4, "dup"}); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw && sessions.size() == 6 && consistent());
+
+    assert(sessions.erase(3) && !sessions.erase(3)); // Middle
+    assert(ids() == "1 2 30 4 5 " && consistent());
+    assert(sessions.erase(1));                       // Head
+    assert(sessions.erase(5));                       // Tail
+    assert(ids() == "2 30 4 " && consistent() && sessions.back().id == 4);
+    sessions.push_back({6, "u6"});
+    sessions.erase_after(sessions.find(30));
+    sessions.pop_back();
+    sessions.pop_front();
+    assert(ids() == "30 " && consistent());
+    for (int id : {7, 8, 9}) sessions.push_back({id, ""});
+    sessions.reverse();
+    assert(ids() == "9 8 7 30 " && consistent());
+
+    auto copy = sessions;
+    copy.erase(8);
+    assert(copy.size() == 3 && sessions.contains(8) && consistent());
+    auto moved = std::move(copy);
+    assert(moved.find(7) != moved.end() && copy.empty() && !copy.contains(7));
+    sessions.clear();
+    assert(sessions.empty() && !sessions.contains(9));
+    sessions.push_back({1, ""});
+    assert(consistent());
+}
+
+
+void testLazyDeletion() {
+    std::cout << "\n========== 23. TESTING REMOVE_IF AND LAZY DELETION ==========\n" << std::endl;
+
+    SinglyLinkedList<int> list{1, 2, 3, 4, 5, 6, 7};
+    assert(list.remove_if([](int v) { return v % 2 == 1; }) == 4);
+    printList(list, "remove_if(odd)");
+    assert(list == (SinglyLinkedList<int>{2, 4, 6}) && list.back() == 6);
+    assert(list.remove_if([](int) { return true; }) == 3 && list.empty());
+
+    LazyDeletionList<std::string> lazy{"a", "b", "c", "d", "e"};
+    // Erase in the middle of a traversal: no predecessor needed.
+    for (auto it = lazy.begin(); it != lazy.end();) {
+        if (*it == "b" || *it == "d" || *it == "a") it = lazy.mark_erased(it);
+        else ++it;
+    }
+    assert(lazy.size() == 2 && lazy.tombstones() == 3 && lazy.front() == "c");
+    std::string seen;
+    for (const auto& s : lazy) seen += s;
+    assert(seen == "ce");
+    auto it = lazy.insert_after(lazy.cbegin(), "x");
+    assert(*it == "x" && lazy.size() == 3);
+    // Marking the same element twice through a kept iterator counts it once.
+    auto c = lazy.begin();
+    lazy.mark_erased(c);
+    lazy.mark_erased(c);
+    assert(lazy.size() == 2 && lazy.tombstones() == 4 && lazy.front() == "x");
+    lazy.push_front("c");
+
+    assert(lazy.purge() == 4 && lazy.tombstones() == 0 && lazy.size() == 3);
+    seen.clear();
+    for (const auto& s : lazy) seen += s;
+    assert(seen == "cxe");
+
+    // Automatic sweep: runs on insertion once tombstones pass half the nodes.
+    LazyDeletionList<int> nums;
+    nums.set_auto_purge(0.5);
+    for (int i = 0; i < 10; ++i) nums.push_back(i);
+    for (auto n = nums.begin(); n != nums.end();) n = *n < 6 ? nums.mark_erased(n) : std::next(n);
+    assert(nums.size() == 4 && nums.tombstones() == 6);
+    nums.push_back(10);
+    assert(nums.tombstones() == 0 && nums.size() == 5 && nums.front() == 6);
+}
+
+
+void testCircularList() {
+    std::cout << "\n========== 24. TESTING CIRCULAR LIST ==========\n" << std::endl;
+
+    CircularSinglyLinkedList<std::string> ring{"b", "c"};
+    ring.push_front("a");
+    ring.push_back("d");
+    auto lap = [&] {
+        std::string out;
+        for (const auto& s : ring) out += s;
+        return out;
+    };
+    std::cout << "ring: " << lap() << std::endl;
+    assert(lap() == "abcd" && ring.size() == 4 && ring.front() == "a" && ring.back() == "d");
+
+    const std::string* a = &ring.front();
+    ring.rotate();
+    assert(lap() == "bcda" && &ring.back() == a); // Same node, now at the back
+    ring.rotate(6);
+    assert(lap() == "dabc");
+    ring.pop_front();
+    assert(lap() == "abc" && ring.back() == "c");
+
+    auto it = ring.insert_after(ring.begin(), "x");
+    assert(*it == "x" && lap() == "axbc");
+    assert(*ring.erase_after(ring.begin()) == "b" && lap() == "abc");
+    auto last = std::next(ring.begin(), 2);
+    assert(std::next(last) == ring.end()); // A lap stops at the back
+    auto after = ring.erase_after(last); // Erases the front
+    assert(after == ring.end() && lap() == "bc" && ring.front() == "b");
+
+    // end() is a sentinel: it stays put across rotate() and push_front() and cannot be inserted after.
+    auto end = ring.end();
+    ring.rotate();
+    ring.push_front("z");
+    assert(end == ring.end() && end != ring.begin() && lap() == "zcb");
+    bool threw = false;
+    try { ring.insert_after(ring.end(), "y"); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw && ring.size() == 3);
+    std::string moved = "w";
+    auto back = ring.insert_after(std::next(ring.begin(), 2), std::move(moved)); // After the back: becomes the back
+    assert(*back == "w" && ring.back() == "w" && lap() == "zcbw" && std::next(back) == ring.end());
+    ring.clear();
+    ring.push_back("b");
+    ring.push_back("c");
+
+    // Round-robin with a cursor: visit 7 turns over 3 tasks, retiring task 2 on its second turn.
+    CircularSinglyLinkedList<int> tasks{1, 2, 3};
+    std::string turns;
+    int seen_two = 0;
+    auto c = tasks.cursor_begin();
+    for (int turn = 0; turn < 7 && c.valid(); ++turn) {
+        turns += std::to_string(*c);
+        if (*c == 2 && ++seen_two == 2) c.erase();
+        else c.advance();
+    }
+    assert(turns == "1231231" && tasks.size() == 2);
+    CircularSinglyLinkedList<int> one{5};
+    auto only = one.cursor_begin();
+    assert(*only.advance() == 5);
+    only.erase();
+    assert(!only.valid() && one.empty() && one.begin() == one.end());
+
+    CircularSinglyLinkedList<int> copy = tasks;
+    tasks.clear();
+    assert(copy.size() == 2 && copy.front() == 1 && copy.back() == 3);
+}
+
+
+void testListPool() {
+    std::cout << "\n========== 25. TESTING SHARED NODE POOL ==========\n" << std::endl;
+
+    ListPool<std::string> pool;
+    using PooledList = ListPool<std::string>::list;
+    auto joined = [](const PooledList& l) {
+        std::string out;
+        for (const auto& s : l) out += s;
+        return out;
+    };
+
+    PooledList a(pool), b(pool);
+    for (const char* s : {"a1", "a2", "a3"}) a.push_back(s);
+    b.push_back("b1");
+    b.emplace_front(2, 'b');
+    assert(joined(a) == "a1a2a3" && joined(b) == "bbb1" && pool.stats().live == 5);
+
+    const std::string* a1 = &a.front();
+    a.move_front_to_back(b); // O(1), the node keeps its address
+    assert(joined(a) == "a2a3" && joined(b) == "bbb1a1" && &b.back() == a1);
+    a.move_front_to_front(b);
+    assert(joined(b) == "a2bbb1a1" && a.size() == 1);
+    b.splice_back(a);
+    assert(a.empty() && joined(b) == "a2bbb1a1a3" && b.size() == 5 && b.back() == "a3");
+    a.push_back("z");
+    a.splice_front(b);
+    assert(b.empty() && joined(a) == "a2bbb1a1a3z" && a.back() == "z");
+
+    auto it = a.insert_after(a.begin(), "x");
+    assert(*it == "x" && a.size() == 7);
+    a.erase_after(a.begin());
+    a.pop_front();
+    assert(joined(a) == "bbb1a1a3z" && pool.stats().live == 5);
+
+    // Freed slots are reused before the pool grows.
+    auto before = pool.stats();
+    {
+        PooledList temp(pool);
+        for (int i = 0; i < 100; ++i) temp.push_back(std::to_string(i));
+        assert(pool.stats().live == 105);
+    } // temp returns its nodes
+    assert(pool.stats().live == 5 && pool.stats().capacity == before.capacity);
+    auto stats = pool.stats();
+    std::cout << "pool: " << stats.live << " live of " << stats.capacity << " slots in " << stats.blocks
+              << " block(s), occupancy " << stats.occupancy() << std::endl;
+
+    pool.reset(); // Frees every list at once
+    assert(pool.stats().live == 0 && a.empty() && b.empty() && a.begin() == a.end());
+    a.push_back("fresh");
+    assert(a.size() == 1 && joined(a) == "fresh");
+
+    ListPool<int> other;
+    ListPool<int>::list foreign(other);
+    ListPool<int> mine;
+    ListPool<int>::list local(mine);
+    bool threw = false;
+    try { local.splice_back(foreign); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+}
+
+
+void testGenerationalHandles() {
+    std::cout << "\n========== 26. TESTING GENERATIONAL HANDLES ==========\n" << std::endl;
+
+    ListPool<std::string> pool;
+    ListPool<std::string>::list jobs(pool), done(pool);
+    auto first = jobs.push_back_handle("parse");
+    auto second = jobs.push_back_handle("build");
+    auto third = jobs.handle_of(jobs.insert_after(jobs.begin(), "fetch"));
+    assert(*pool.resolve(first) == "parse" && *pool.resolve(third) == "fetch" && *pool.resolve(second) == "build");
+
+    // Handles follow the node across lists.
+    jobs.move_front_to_back(done);
+    assert(pool.resolve(first) == &done.front());
+
+    // Erased: the handle fails safely instead of dangling.
+    jobs.pop_front();
+    assert(pool.resolve(third) == nullptr && pool.resolve(second) != nullptr);
+
+    // The freed slot is recycled for a new element: the old handle still fails.
+    auto recycled = jobs.push_back_handle("deploy");
+    assert(recycled.index == third.index && recycled != third);
+    assert(pool.resolve(third) == nullptr && *pool.resolve(recycled) == "deploy");
+
+    pool.reset();
+    assert(!pool.resolve(first) && !pool.resolve(second) && !pool.resolve(recycled));
+    assert(pool.resolve(ListPool<std::string>::handle{}) == nullptr); // Default handle never resolves
+}
+
+
+void testRunLengthList() {
+    std::cout << "\n========== 27. TESTING RUN-LENGTH ENCODED LIST ==========\n" << std::endl;
+
+    RunLengthList<char> rle;
+    for (char c : std::string("aaaabbbaaaaaa")) rle.push_back(c);
+    rle.push_back('c', 1000000);
+    assert(rle.size() == 1000013 && rle.runs() == 4 && rle.back() == 'c');
+    std::cout << "1000013 elements in " << rle.runs() << " runs" << std::endl;
+
+    auto text = [](const RunLengthList<char>& l) { return std::string(l.begin(), l.end()); };
+    RunLengthList<char> s{'x', 'x', 'y', 'y', 'y'};
+    assert(text(s) == "xxyyy" && s.runs() == 2);
+    s.push_front('x');
+    assert(s.runs() == 2 && s.front() == 'x' && s.size() == 6);
+
+    // insert_after: join the run, join the next run, add a run at a boundary, split a run.
+    auto at = [&](std::size_t i) { return std::next(s.cbegin(), i); };
+    assert(*s.insert_after(at(0), 'x') == 'x' && text(s) == "xxxxyyy" && s.runs() == 2);
+    s.insert_after(at(3), 'y');
+    assert(text(s) == "xxxxyyyy" && s.runs() == 2);
+    s.insert_after(at(7), 'z');
+    assert(text(s) == "xxxxyyyyz" && s.runs() == 3 && s.back() == 'z');
+    auto mid = s.insert_after(at(1), 'q');
+    assert(*mid == 'q' && text(s) == "xxqxxyyyyz" && s.runs() == 5);
+
+    // erase_after: shrink a run, drop a run and merge its equal neighbours.
+    auto next = s.erase_after(at(1));
+    assert(*next == 'x' && text(s) == "xxxxyyyyz" && s.runs() == 3);
+    s.erase_after(at(4));
+    assert(text(s) == "xxxxyyyz" && s.size() == 8);
+    s.erase_after(at(6));
+    assert(text(s) == "xxxxyyy" && s.runs() == 2 && s.back() == 'y');
+    while (s.front() == 'x') s.pop_front();
+    assert(text(s) == "yyy" && s.runs() == 1);
+
+    RunLengthList<char> copy = rle;
+    assert(copy == rle && copy.runs() == 4);
+    copy.pop_front();
+    assert(copy != rle && copy.size() == rle.size() - 1);
+}
+
+
+void testRope() {
+    std::cout << "\n========== 28. TESTING ROPE STRING BUILDER ==========\n" << std::endl;
+
+    Rope rope(16);
+    rope.append("HTTP/1.1 200 OK\r\n").append("Content-Type: text/plain\r\n");
+    rope += "\r\n";
+    assert(rope.size() == 45 && rope.chunks() == 3);
+    rope += "ok";
+    assert(rope.chunks() == 3); // Fits the spare capacity of the last chunk
+    assert(rope.flatten() == "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n\r\nok");
+
+    std::string big(10000, 'x');
+    const char* big_data = big.data();
+    Rope body(16);
+    body += std::move(big);
+    body.for_each_chunk([&](std::string_view chunk) { assert(chunk.data() == big_data); }); // Adopted, not copied
+
+    // Concatenation splices the chains and leaves the source empty.
+    Rope copy = rope;
+    rope += std::move(body);
+    assert(body.empty() && body.chunks() == 0 && rope.size() == 47 + 10000 && rope.chunks() == 4);
+    assert(copy.size() == 47 && copy.flatten() + std::string(10000, 'x') == rope.flatten());
+    body += "reused";
+    assert(body.flatten() == "reused");
+
+    // writev output, across more chunks than one call may submit.
+    Rope many(1);
+    std::string expected;
+    for (int i = 0; i < 3000; ++i) {
+        std::string piece = std::to_string(i) + ",";
+        many += piece;
+        expected += piece;
+    }
+    assert(many.chunks() == 3000);
+    std::FILE* file = std::tmpfile();
+    assert(file);
+    assert(many.write_to(fileno(file)) == expected.size());
+    std::rewind(file);
+    std::string read_back(expected.size(), '\0');
+    assert(std::fread(&read_back[0], 1, read_back.size(), file) == read_back.size());
+    std::fclose(file);
+    assert(read_back == expected);
+
+    bool threw = false;
+    try { many.write_to(-1); } catch (const std::system_error&) { threw = true; }
+    assert(threw);
+    std::cout << "Wrote " << expected.size() << " bytes from " << many.chunks() << " chunks" << std::endl;
+}
+
+
+void testPairingHeap() {
+    std::cout << "\n========== 29. TESTING PAIRING HEAP ==========\n" << std::endl;
+
+    PairingHeap<int> heap;
+    std::vector<PairingHeap<int>::handle> handles;
+    for (int v : {50, 20, 80, 10, 70, 30, 60, 40}) handles.push_back(heap.push(v));
+    assert(heap.size() == 8 && heap.top() == 10);
+    heap.pop();
+    heap.pop();
+    assert(heap.top() == 30 && heap.size() == 6);
+
+    // decrease_key on an inner node, then on the root itself.
+    heap.decrease_key(handles[2], 5); // 80 -> 5
+    assert(heap.top() == 5 && heap.value(handles[2]) == 5);
+    heap.decrease_key(handles[2], 1);
+    assert(heap.top() == 1);
+    bool threw = false;
+    try { heap.decrease_key(handles[4], 99); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw && heap.value(handles[4]) == 70);
+
+    // Meld: handles into the source keep working in the destination.
+    PairingHeap<int> other;
+    auto h = other.push(45);
+    other.push(15);
+    heap.meld(other);
+    assert(other.empty() && heap.size() == 8);
+    heap.decrease_key(h, 0);
+    std::vector<int> drained;
+    while (!heap.empty()) { drained.push_back(heap.top()); heap.pop(); }
+    assert((drained == std::vector<int>{0, 1, 15, 30, 40, 50, 60, 70}));
+
+    // Random pushes, pops and decrease_keys against a sorted reference, on a non-trivial type.
+    PairingHeap<std::string> strings;
+    std::vector<std::pair<PairingHeap<std::string>::handle, std::string>> live;
+    std::vector<std::string> reference;
+    std::uint32_t x = 12345;
+    auto rnd = [&x] { x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+    for (int step = 0; step < 5000; ++step) {
+        std::uint32_t op = rnd() % 4;
+        if (op < 2 || live.empty()) {
+            std::string v = std::to_string(100000 + rnd() % 900000) + "#" + std::to_string(step); // Unique
+            live.push_back({strings.push(v), v});
+            reference.push_back(v);
+        } else if (op == 2) {
+            std::string top = strings.top();
+            assert(top == *std::min_element(reference.begin(), reference.end()));
+            strings.pop();
+            reference.erase(std::find(reference.begin(), reference.end(), top));
+            live.erase(std::find_if(live.begin(), live.end(), [&](const auto& e) { return e.second == top; }));
+        } else {
+            auto& [handle, v] = live[rnd() % live.size()];
+            std::string smaller = "0" + v.substr(1);
+            *std::find(reference.begin(), reference.end(), v) = smaller;
+            strings.decrease_key(handle, smaller);
+            v = smaller;
+        }
+        assert(strings.size() == reference.size());
+    }
+    std::cout << "Random operations matched the reference, " << strings.size() << " elements left" << std::endl;
+
+    // Dijkstra with decrease_key on a small grid against Bellman-Ford.
+    const int side = 20, n = side * side;
+    std::vector<std::vector<std::pair<int, int>>> adj(n);
+    for (int v = 0; v < n; ++v) {
+        if (v % side + 1 < side) { int w = int(rnd() % 9) + 1; adj[v].push_back({v + 1, w}); adj[v + 1].push_back({v, w}); }
+        if (v + side < n) { int w = int(rnd() % 9) + 1; adj[v].push_back({v + side, w}); adj[v + side].push_back({v, w}); }
+    }
+    using Entry = std::pair<long, int>;
+    PairingHeap<Entry> queue;
+    std::vector<PairingHeap<Entry>::handle> where(n);
+    std::vector<long> dist(n, -1);
+    std::vector<bool> done(n, false);
+    dist[0] = 0;
+    where[0] = queue.push({0, 0});
+    while (!queue.empty()) {
+        int v = queue.top().second;
+        queue.pop();
+        done[v] = true;
+        for (auto [u, w] : adj[v]) {
+            if (done[u]) continue;
+            long d = dist[v] + w;
+            if (dist[u] < 0) { dist[u] = d; where[u] = queue.push({d, u}); }
+            else if (d < dist[u]) { dist[u] = d; queue.decrease_key(where[u], {d, u}); }
+        }
+    }
+    std::vector<long> bf(n, 1L << 40);
+    bf[0] = 0;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int v = 0; v < n; ++v)
+            for (auto [u, w] : adj[v])
+                if (bf[v] + w < bf[u]) { bf[u] = bf[v] + w; changed = true; }
+    }
+    assert(dist == bf);
+}
+
+
+void testRadixHeap() {
+    std::cout << "\n========== 30. TESTING RADIX HEAP ==========\n" << std::endl;
+
+    RadixHeap<std::uint32_t, std::string> events;
+    events.push(30, "c");
+    events.push(10, "a");
+    events.push(20, "b");
+    events.push(10, "a2");
+    assert(events.size() == 4 && events.top_key() == 10 && events.last_key() == 10);
+    std::string first = events.top();
+    events.pop();
+    assert((first == "a" || first == "a2") && events.top_key() == 10);
+    events.pop();
+    bool threw = false;
+    try { events.push(5, "past"); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw && events.size() == 2);
+    events.push(10, "now"); // Equal to the last key taken is allowed
+    assert(events.top_key() == 10 && events.top() == "now");
+
+    // Event simulation: pop the earliest event and schedule follow-ups, checked against a multiset.
+    RadixHeap<std::uint64_t, std::uint32_t> sim;
+    std::multiset<std::uint64_t> reference;
+    std::uint64_t x = 88172645463325252ull;
+    auto rnd = [&x] { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; };
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        std::uint64_t t = rnd() % 100000;
+        sim.push(t, i);
+        reference.insert(t);
+    }
+    for (int step = 0; step < 20000 && !sim.empty(); ++step) {
+        std::uint64_t now = sim.top_key();
+        assert(now == *reference.begin());
+        sim.pop();
+        reference.erase(reference.begin());
+        for (std::uint64_t k = rnd() % 3; k > 0; --k) {
+            std::uint64_t when = now + (rnd() % 4 == 0 ? rnd() % (1ull << 40) : rnd() % 1000);
+            sim.push(when, std::uint32_t(step));
+            reference.insert(when);
+        }
+        assert(sim.size() == reference.size());
+    }
+    std::cout << "Simulation matched the reference, " << sim.size() << " events pending at t=" << sim.last_key() << std::endl;
+
+    RadixHeap<std::uint64_t, std::uint32_t> moved = std::move(sim);
+    assert(sim.empty() && moved.size() == reference.size());
+    moved.clear();
+    assert(moved.empty());
+}
+
+
+void testSparseVectors() {
+    std::cout << "\n========== 31. TESTING SPARSE VECTOR KERNELS ==========\n" << std::endl;
+
+    using Vec = SparseVector<>;
+    Vec a{{1, 2.0f}, {4, 1.0f}, {7, 3.0f}};
+    Vec b{{0, 5.0f}, {4, 2.0f}, {7, -1.0f}, {9, 4.0f}};
+    assert(sparse_dot(a, b) == 2.0f * 1.0f + 3.0f * -1.0f);
+    assert(sparse_dot(a, Vec{}) == 0.0f);
+
+    // axpy keeps a's nodes and splices in b's extra indices, at the front, middle and back.
+    const auto* kept = &*std::next(a.begin());
+    sparse_axpy(2.0f, b, a);
+    assert((a == Vec{{0, 10.0f}, {1, 2.0f}, {4, 5.0f}, {7, 1.0f}, {9, 8.0f}}));
+    assert(&*std::next(a.begin(), 2) == kept);
+
+    Vec c{{4, 1.0f}};
+    sparse_add(c, Vec{{2, 1.0f}, {4, 1.0f}});
+    assert((c == Vec{{2, 1.0f}, {4, 2.0f}}));
+    sparse_axpy(2.0, Vec{{4, 1.0f}}, c); // A double alpha converts; only the vectors fix Value
+    sparse_axpy(1, Vec{{2, 1.0f}}, c);
+    assert((c == Vec{{2, 2.0f}, {4, 4.0f}}));
+
+    // multiply drops indices missing from the other operand, including the front and the back.
+    sparse_multiply(a, Vec{{1, 3.0f}, {7, 2.0f}, {8, 1.0f}});
+    assert((a == Vec{{1, 6.0f}, {7, 2.0f}}));
+    sparse_multiply(a, Vec{});
+    assert(a.empty());
+
+    // Random vectors against dense arithmetic.
+    std::uint32_t x = 2463534242u;
+    auto rnd = [&x] { x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+    const std::uint32_t dim = 500;
+    auto make = [&](std::vector<float>& dense) {
+        Vec v;
+        dense.assign(dim, 0.0f);
+        for (std::uint32_t i = 0; i < dim; ++i)
+            if (rnd() % 5 == 0) { dense[i] = float(rnd() % 7) - 3.0f; v.push_back({i, dense[i]}); }
+        return v;
+    };
+    std::vector<float> dx, dy;
+    Vec sx = make(dx), sy = make(dy);
+    float expected = 0;
+    for (std::uint32_t i = 0; i < dim; ++i) expected += dx[i] * dy[i];
+    assert(sparse_dot(sx, sy) == expected);
+    sparse_axpy(0.5f, sx, sy);
+    sparse_multiply(sy, sx);
+    std::vector<float> got(dim, 0.0f);
+    std::uint32_t last = 0;
+    for (auto [i, v] : sy) { assert(i >= last); last = i; got[i] = v; }
+    for (std::uint32_t i = 0; i < dim; ++i) assert(got[i] == (dy[i] + 0.5f * dx[i]) * dx[i]);
+
+    // CSR packing and batched evaluation.
+    std::vector<Vec> rows{sx, Vec{}, Vec{{3, 2.0f}}};
+    auto block = to_csr(rows.begin(), rows.end());
+    assert(block.rows() == 3 && block.nonzeros() == sx.size() + 1);
+    assert(block.row_offsets[1] == sx.size() && block.row_offsets[2] == sx.size());
+    std::vector<float> out(block.rows());
+    block.multiply(dy.data(), out.data());
+    assert(out[0] == expected && out[1] == 0.0f && out[2] == 2.0f * dy[3]);
+}
+
 
 int main() {
     std::cout << "--- SINGLY LINKED LIST TEST SUITE ---" << std::endl;
@@ -275,6 +1490,31 @@ int main() {
     testInsertEraseReverse();
     testEmplacementAndMove();
     testComparisons();
+    testReclamation();
+    testNumaPlacement();
+    testCacheAlignedLayout();
+    testSplitNodes();
+    testBatchedAppend();
+    testBackPoppable();
+    testReverseView();
+    testCursor();
+    testInsertSorted();
+    testRelinking();
+    testMergeK();
+    testSorting();
+    testSelection();
+    testDedupe();
+    testMembershipFilter();
+    testIndexedList();
+    testLazyDeletion();
+    testCircularList();
+    testListPool();
+    testGenerationalHandles();
+    testRunLengthList();
+    testRope();
+    testPairingHeap();
+    testRadixHeap();
+    testSparseVectors();
 
     std::cout << "\n--- ALL TESTS COMPLETED ---" << std::endl;
 